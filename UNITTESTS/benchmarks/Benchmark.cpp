@@ -0,0 +1,113 @@
+/**
+ * @file    Benchmark.cpp
+ * @brief   Minimal host micro-benchmark runner reporting ns/op and allocations/op
+ */
+
+#include "Benchmark.h"
+#include "AllocationCounter.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static uint64_t now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// BenchmarkState
+BenchmarkState::BenchmarkState(uint64_t iterations) :
+    m_iterations(iterations), m_remaining(iterations), m_running(false), m_started(false),
+    m_start_ns(0), m_start_allocations(0), m_start_bytes(0), m_elapsed_ns(0), m_allocations(0), m_allocated_bytes(0) {
+}
+
+bool BenchmarkState::keepRunning() {
+    if (this->m_started == false) {
+        this->m_started = true;
+        this->start();
+    }
+    if (this->m_remaining == 0) {
+        if (this->m_running) this->stop();
+        return false;
+    }
+    --this->m_remaining;
+    return true;
+}
+
+void BenchmarkState::pauseTiming() { if (this->m_running) this->stop(); }
+void BenchmarkState::resumeTiming() { if (!this->m_running) this->start(); }
+
+void BenchmarkState::start() {
+    this->m_running = true;
+    this->m_start_allocations = process_allocation_count();
+    this->m_start_bytes = process_allocated_bytes();
+    this->m_start_ns = now_ns();
+}
+
+void BenchmarkState::stop() {
+    uint64_t end_ns = now_ns();
+    this->m_elapsed_ns += end_ns - this->m_start_ns;
+    this->m_allocations += process_allocation_count() - this->m_start_allocations;
+    this->m_allocated_bytes += process_allocated_bytes() - this->m_start_bytes;
+    this->m_running = false;
+}
+
+// registry
+struct BenchmarkEntry {
+    const char        *name;
+    BenchmarkFunction  function;
+};
+
+static std::vector<BenchmarkEntry> &registry() {
+    static std::vector<BenchmarkEntry> entries;
+    return entries;
+}
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char *name,BenchmarkFunction function) {
+    BenchmarkEntry entry = { name, function };
+    registry().push_back(entry);
+}
+
+// grow the iteration count until a run lasts at least min_time_ns (or max_iterations is reached)
+static BenchmarkState run_benchmark(BenchmarkFunction function,uint64_t min_time_ns,uint64_t max_iterations) {
+    uint64_t iterations = 1;
+    while (true) {
+        BenchmarkState state(iterations);
+        function(state);
+        if (state.elapsedNs() >= min_time_ns || iterations >= max_iterations) {
+            return state;
+        }
+        uint64_t next = (state.elapsedNs() > 0) ? (uint64_t)((double)iterations * 1.4 * (double)min_time_ns / (double)state.elapsedNs()) : iterations * 10;
+        if (next <= iterations) next = iterations + 1;
+        if (next > iterations * 10) next = iterations * 10;
+        iterations = (next < max_iterations) ? next : max_iterations;
+    }
+}
+
+int main(int argc,char **argv) {
+    bool quick = false;
+    const char *filter = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i],"--quick") == 0) quick = true;
+        else filter = argv[i];
+    }
+
+    // --quick: a smoke run (ctest) that checks every benchmark completes
+    uint64_t min_time_ns = quick ? 1000000ULL : 250000000ULL;
+    uint64_t max_iterations = quick ? 1000ULL : 100000000ULL;
+
+    printf("%-48s %12s %14s %12s %12s\n","benchmark","iterations","ns/op","allocs/op","bytes/op");
+    for (size_t i = 0; i < registry().size(); ++i) {
+        const BenchmarkEntry &entry = registry()[i];
+        if (filter != NULL && strstr(entry.name,filter) == NULL) {
+            continue;
+        }
+        BenchmarkState state = run_benchmark(entry.function,min_time_ns,max_iterations);
+        double n = (double)state.iterations();
+        printf("%-48s %12llu %14.1f %12.2f %12.1f\n",entry.name,(unsigned long long)state.iterations(),
+               (double)state.elapsedNs() / n,(double)state.allocations() / n,(double)state.allocatedBytes() / n);
+        fflush(stdout);
+    }
+    return 0;
+}
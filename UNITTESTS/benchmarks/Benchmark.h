@@ -0,0 +1,71 @@
+/**
+ * @file    Benchmark.h
+ * @brief   Minimal host micro-benchmark runner reporting ns/op and allocations/op
+ *
+ *   BENCHMARK(notify_unchanged) {
+ *       ...setup (not timed)...
+ *       while (state.keepRunning()) {
+ *           ...the operation being measured...
+ *       }
+ *   }
+ *
+ * Usage: connector_benchmarks [--quick] [filter]
+ */
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <stdint.h>
+
+class BenchmarkState {
+public:
+    explicit BenchmarkState(uint64_t iterations);
+
+    // true while more iterations are to be run (timing starts on the first call)
+    bool keepRunning();
+
+    // exclude per-iteration setup/teardown from the measurement
+    void pauseTiming();
+    void resumeTiming();
+
+    // results
+    uint64_t iterations() const { return this->m_iterations; }
+    uint64_t elapsedNs() const { return this->m_elapsed_ns; }
+    uint64_t allocations() const { return this->m_allocations; }
+    uint64_t allocatedBytes() const { return this->m_allocated_bytes; }
+
+private:
+    void start();
+    void stop();
+
+    uint64_t m_iterations;
+    uint64_t m_remaining;
+    bool     m_running;
+    bool     m_started;
+    uint64_t m_start_ns;
+    uint64_t m_start_allocations;
+    uint64_t m_start_bytes;
+    uint64_t m_elapsed_ns;
+    uint64_t m_allocations;
+    uint64_t m_allocated_bytes;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState &state);
+
+// registers a benchmark at static initialization time
+class BenchmarkRegistrar {
+public:
+    BenchmarkRegistrar(const char *name,BenchmarkFunction function);
+};
+
+// keep the optimizer from discarding a result
+template <typename T> inline void benchmark_do_not_optimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#define BENCHMARK(name) \
+    static void benchmark_##name(BenchmarkState &state); \
+    static BenchmarkRegistrar benchmark_registrar_##name(#name,benchmark_##name); \
+    static void benchmark_##name(BenchmarkState &state)
+
+#endif // __BENCHMARK_H__
@@ -0,0 +1,39 @@
+/**
+ * @file    bind_benchmarks.cpp
+ * @brief   Endpoint::buildEndpoint() resource binding cost
+ */
+
+#include "Benchmark.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+#include <vector>
+
+extern Logger logger;
+
+static void bind_resources(BenchmarkState &state,int count,int objects) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        HostEndpoint *host = new HostEndpoint(&logger);
+        std::vector<CountingResource *> resources;
+        for (int i = 0; i < count; ++i) {
+            resources.push_back(new CountingResource(&logger,indexed_name("",1000 + (i % objects)).c_str(),indexed_name("",5000 + i).c_str()));
+            host->add(resources.back());
+        }
+        state.resumeTiming();
+
+        benchmark_do_not_optimize(host->build());
+
+        state.pauseTiming();
+        delete host;
+        for (size_t i = 0; i < resources.size(); ++i) delete resources[i];
+        state.resumeTiming();
+    }
+}
+
+// one op == binding every resource of the endpoint
+BENCHMARK(bind_8_resources) { bind_resources(state,8,2); }
+BENCHMARK(bind_32_resources) { bind_resources(state,32,4); }
+BENCHMARK(bind_128_resources) { bind_resources(state,128,8); }
+BENCHMARK(bind_1000_resources) { bind_resources(state,1000,16); }
@@ -0,0 +1,63 @@
+/**
+ * @file    decode_benchmarks.cpp
+ * @brief   Typed CoAP payload decoding cost (coapDataToInteger/coapDataToFloat/coapDataToString)
+ */
+
+#include "Benchmark.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+static CountingResource *decoder() {
+    static CountingResource *resource = NULL;
+    if (resource == NULL) {
+        logger.setLevel(LOGGER_LEVEL_NONE);
+        resource = new CountingResource(&logger,"3303","5700");
+    }
+    return resource;
+}
+
+static CountingResource *binaryDecoder() {
+    static CountingResource *resource = NULL;
+    if (resource == NULL) {
+        logger.setLevel(LOGGER_LEVEL_NONE);
+        resource = new CountingResource(&logger,"3303","5701");
+        resource->setContentFormat(42);
+    }
+    return resource;
+}
+
+BENCHMARK(decode_integer_text) {
+    uint8_t payload[] = "-123456";
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(decoder()->coapDataToInteger(payload,7));
+    }
+}
+
+BENCHMARK(decode_integer_binary) {
+    uint8_t payload[] = { 0xFF, 0xFF, 0xFE, 0x0C };
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(binaryDecoder()->coapDataToInteger(payload,4));
+    }
+}
+
+BENCHMARK(decode_float_text) {
+    uint8_t payload[] = "21.375";
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(decoder()->coapDataToFloat(payload,6));
+    }
+}
+
+BENCHMARK(decode_float_binary) {
+    uint8_t payload[] = { 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(binaryDecoder()->coapDataToFloat(payload,8));
+    }
+}
+
+BENCHMARK(decode_string) {
+    uint8_t payload[] = "21.375";
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(decoder()->coapDataToString(payload,6));
+    }
+}
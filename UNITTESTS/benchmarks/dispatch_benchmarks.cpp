@@ -0,0 +1,89 @@
+/**
+ * @file    dispatch_benchmarks.cpp
+ * @brief   Inbound request dispatch cost (Endpoint::value_updated() lookup + DynamicResource::process())
+ */
+
+#include "Benchmark.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/DynamicResourceIndex.h"
+
+#include <vector>
+
+extern Logger logger;
+
+// an endpoint with "count" bound resources (resource 0 is the dispatch target)
+class DispatchFixture {
+public:
+    explicit DispatchFixture(int count) : m_host(&logger) {
+        logger.setLevel(LOGGER_LEVEL_NONE);
+        for (int i = 0; i < count; ++i) {
+            this->m_resources.push_back(new CountingResource(&logger,"3311",indexed_name("",5000 + i).c_str()));
+            this->m_host.add(this->m_resources.back());
+        }
+        this->m_endpoint = this->m_host.build();
+        this->m_target = this->m_resources[count - 1];
+        M2MResource *res = (M2MResource *)this->m_target->getResource();
+        res->set_value((const uint8_t *)"42",2);
+    }
+    ~DispatchFixture() {
+        for (size_t i = 0; i < this->m_resources.size(); ++i) delete this->m_resources[i];
+    }
+
+    HostEndpoint                     m_host;
+    Connector::Endpoint             *m_endpoint;
+    std::vector<CountingResource *>  m_resources;
+    CountingResource                *m_target;
+};
+
+static void dispatch_put(BenchmarkState &state,int count) {
+    DispatchFixture fixture(count);
+    M2MResource *res = (M2MResource *)fixture.m_target->getResource();
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    while (state.keepRunning()) {
+        fixture.m_endpoint->value_updated(res,M2MBase::Resource);
+    }
+}
+
+// value_updated(): resource lookup plus PUT processing
+BENCHMARK(dispatch_put_1_resource) { dispatch_put(state,1); }
+BENCHMARK(dispatch_put_32_resources) { dispatch_put(state,32); }
+BENCHMARK(dispatch_put_1000_resources) { dispatch_put(state,1000); }
+
+// process() alone
+BENCHMARK(process_put) {
+    DispatchFixture fixture(1);
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(fixture.m_target->process(M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    }
+}
+
+BENCHMARK(process_post) {
+    DispatchFixture fixture(1);
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(fixture.m_target->process(M2MBase::POST_ALLOWED,M2MBase::Resource));
+    }
+}
+
+// index lookup alone (hit and miss)
+static void index_lookup(BenchmarkState &state,int count,bool hit) {
+    DispatchFixture fixture(count);
+    std::vector<DynamicResource *> list(fixture.m_resources.begin(),fixture.m_resources.end());
+    DynamicResourceIndex index;
+    index.build(&list);
+    M2MResource other("other");
+    const void *key = hit ? fixture.m_resources[count / 2]->getResource() : (const void *)&other;
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(index.lookup(key));
+    }
+}
+
+BENCHMARK(index_lookup_hit_1000_resources) { index_lookup(state,1000,true); }
+BENCHMARK(index_lookup_miss_1000_resources) { index_lookup(state,1000,false); }
+
+BENCHMARK(process_delete) {
+    DispatchFixture fixture(1);
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(fixture.m_target->process(M2MBase::DELETE_ALLOWED,M2MBase::Resource));
+    }
+}
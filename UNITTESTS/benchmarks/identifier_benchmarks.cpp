@@ -0,0 +1,50 @@
+/**
+ * @file    identifier_benchmarks.cpp
+ * @brief   Identifier interning and name lookup cost (IdentifierTable)
+ */
+
+#include "Benchmark.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/IdentifierTable.h"
+
+#include <vector>
+
+extern Logger logger;
+
+// a table holding 1000 string identifiers (interned once)
+static const std::vector<std::string> &identifiers() {
+    static std::vector<std::string> names;
+    if (names.empty()) {
+        for (int i = 0; i < 1000; ++i) {
+            names.push_back(indexed_name("bench_ident_",i));
+            IdentifierTable::instance()->intern(names.back().c_str());
+        }
+    }
+    return names;
+}
+
+BENCHMARK(intern_hit_1000_identifiers) {
+    const std::vector<std::string> &names = identifiers();
+    size_t i = 0;
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(IdentifierTable::instance()->intern(names[i].c_str()));
+        i = (i + 1) % names.size();
+    }
+}
+
+BENCHMARK(intern_numeric) {
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(IdentifierTable::instance()->intern("5700"));
+    }
+}
+
+BENCHMARK(resource_get_res_name) {
+    static CountingResource *resource = NULL;
+    if (resource == NULL) {
+        logger.setLevel(LOGGER_LEVEL_NONE);
+        resource = new CountingResource(&logger,"3303","bench_name");
+    }
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource->getResName().c_str());
+    }
+}
@@ -0,0 +1,44 @@
+/**
+ * @file    logger_benchmarks.cpp
+ * @brief   Logging cost (filtered, synchronous and asynchronous)
+ */
+
+#include "Benchmark.h"
+#include "mbed-connector-interface/Logger.h"
+
+BENCHMARK(log_filtered) {
+    Serial pc(USBTX,USBRX);
+    Logger logger(&pc);
+    logger.setLevel(LOGGER_LEVEL_WARN);
+    int i = 0;
+    while (state.keepRunning()) {
+        LOG_DEBUG(&logger,LOGGER_MODULE_RESOURCE,"%s: [%s]=[%d] filtered",__func__,"3303/0/5700",++i);
+    }
+}
+
+BENCHMARK(log_sync) {
+    Serial pc(USBTX,USBRX);
+    Logger logger(&pc);
+    logger.setLevel(LOGGER_LEVEL_DEBUG);
+    int i = 0;
+    while (state.keepRunning()) {
+        LOG_DEBUG(&logger,LOGGER_MODULE_RESOURCE,"%s: [%s]=[%d] written",__func__,"3303/0/5700",++i);
+    }
+}
+
+BENCHMARK(log_async) {
+    // the drain thread cannot be terminated on the host... one async Logger serves every run
+    static Serial pc(USBTX,USBRX);
+    static Logger *logger = NULL;
+    if (logger == NULL) {
+        logger = new Logger(&pc);
+        logger->setLevel(LOGGER_LEVEL_DEBUG);
+        logger->startAsync();
+    }
+    int i = 0;
+    while (state.keepRunning()) {
+        LOG_DEBUG(logger,LOGGER_MODULE_RESOURCE,"%s: [%s]=[%d] queued",__func__,"3303/0/5700",++i);
+    }
+    state.pauseTiming();
+    logger->flush();
+}
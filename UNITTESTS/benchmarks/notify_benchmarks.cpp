@@ -0,0 +1,72 @@
+/**
+ * @file    notify_benchmarks.cpp
+ * @brief   Notification cost (DynamicResource::notify() and observe())
+ */
+
+#include "Benchmark.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+BENCHMARK(notify_string) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5700");
+    host.add(&resource).build();
+    std::string values[2] = { "21.5", "21.6" };
+    uint64_t i = 0;
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource.notify(values[(i++) & 1]));
+    }
+}
+
+BENCHMARK(notify_bytes) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5700");
+    host.add(&resource).build();
+    const uint8_t payload[] = "21.5";
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource.notify(payload,4));
+    }
+}
+
+// payloads beyond the std::string small buffer (no per-notify copies of the value)
+BENCHMARK(notify_string_256) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5701");
+    host.add(&resource).build();
+    std::string value(256,'v');
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource.notify(value));
+    }
+}
+
+BENCHMARK(notify_bytes_256) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5702");
+    host.add(&resource).build();
+    uint8_t payload[256];
+    memset(payload,'v',sizeof(payload));
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource.notify(payload,(int)sizeof(payload)));
+    }
+}
+
+BENCHMARK(notify_wrapped_256) {
+    logger.setLevel(LOGGER_LEVEL_NONE);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5703");
+    DataWrapper wrapper(512);
+    host.add(&resource).build();
+    resource.setDataWrapper(&wrapper);
+    uint8_t payload[256];
+    memset(payload,'v',sizeof(payload));
+    while (state.keepRunning()) {
+        benchmark_do_not_optimize(resource.notify(payload,(int)sizeof(payload)));
+    }
+    resource.setDataWrapper(NULL);
+}
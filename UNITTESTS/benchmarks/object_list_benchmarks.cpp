@@ -0,0 +1,46 @@
+/**
+ * @file    object_list_benchmarks.cpp
+ * @brief   Object tree (NamedPointerList) growth and traversal cost
+ */
+
+#include "Benchmark.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/NamedPointer.h"
+
+extern Logger logger;
+
+// one op == growing a list of 64 objects, each holding 4 instances (moves, not deep copies, on reallocation)
+BENCHMARK(object_list_grow_64_objects) {
+    while (state.keepRunning()) {
+        NamedPointerList list;
+        for (int i = 0; i < 64; ++i) {
+            list.push_back(NamedPointer((IdentifierHandle)(1000 + i),NULL,i));
+            NamedPointerList *instances = (NamedPointerList *)list.back().list();
+            for (int j = 0; j < 4; ++j) {
+                instances->push_back(NamedPointer((IdentifierHandle)j,NULL,j));
+            }
+        }
+        benchmark_do_not_optimize(list.size());
+    }
+}
+
+// one op == walking the object list of a 128 resource endpoint the way Endpoint::buildEndpoint() does
+BENCHMARK(object_list_walk_128_resources) {
+    static ObjectInstanceManager *manager = NULL;
+    if (manager == NULL) {
+        logger.setLevel(LOGGER_LEVEL_NONE);
+        manager = new ObjectInstanceManager(&logger,NULL);
+        for (int i = 0; i < 128; ++i) {
+            manager->createDynamicResourceInstance((IdentifierHandle)(1000 + (i % 8)),(IdentifierHandle)(5000 + i),"bench",M2MResourceInstance::INTEGER,false);
+        }
+    }
+    while (state.keepRunning()) {
+        const NamedPointerList &list = manager->getObjectList();
+        int instances = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            instances += ((NamedPointer &)list[i]).listSize();
+        }
+        benchmark_do_not_optimize(instances);
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file    AllocationCounter.cpp
+ * @brief   Heap allocation counting for the host unit tests and benchmarks (interposes the glibc allocator entry points)
+ */
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+// glibc's allocator entry points (the public names are interposed below to count allocations)
+extern "C" {
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count,size_t size);
+    void *__libc_realloc(void *ptr,size_t size);
+    void  __libc_free(void *ptr);
+}
+
+static std::atomic<uint64_t> s_allocations(0);
+static std::atomic<uint64_t> s_allocated_bytes(0);
+
+// plain (constant initialized) thread locals: no allocation on first use
+static __thread uint64_t t_allocations = 0;
+static __thread uint64_t t_allocated_bytes = 0;
+
+static inline void count_allocation(size_t size) {
+    s_allocations.fetch_add(1,std::memory_order_relaxed);
+    s_allocated_bytes.fetch_add(size,std::memory_order_relaxed);
+    ++t_allocations;
+    t_allocated_bytes += size;
+}
+
+extern "C" void *malloc(size_t size) { count_allocation(size); return __libc_malloc(size); }
+extern "C" void *calloc(size_t count,size_t size) { count_allocation(count * size); return __libc_calloc(count,size); }
+extern "C" void *realloc(void *ptr,size_t size) { count_allocation(size); return __libc_realloc(ptr,size); }
+extern "C" void free(void *ptr) { __libc_free(ptr); }
+
+static void *counted_new(size_t size) {
+    count_allocation(size);
+    void *ptr = __libc_malloc(size > 0 ? size : 1);
+    if (ptr == NULL) throw std::bad_alloc();
+    return ptr;
+}
+void *operator new(size_t size) { return counted_new(size); }
+void *operator new[](size_t size) { return counted_new(size); }
+void *operator new(size_t size,const std::nothrow_t &) noexcept { count_allocation(size); return __libc_malloc(size > 0 ? size : 1); }
+void *operator new[](size_t size,const std::nothrow_t &) noexcept { count_allocation(size); return __libc_malloc(size > 0 ? size : 1); }
+void operator delete(void *ptr) noexcept { __libc_free(ptr); }
+void operator delete[](void *ptr) noexcept { __libc_free(ptr); }
+void operator delete(void *ptr,size_t) noexcept { __libc_free(ptr); }
+void operator delete[](void *ptr,size_t) noexcept { __libc_free(ptr); }
+
+uint64_t process_allocation_count() { return s_allocations.load(std::memory_order_relaxed); }
+uint64_t process_allocated_bytes() { return s_allocated_bytes.load(std::memory_order_relaxed); }
+uint64_t thread_allocation_count() { return t_allocations; }
+uint64_t thread_allocated_bytes() { return t_allocated_bytes; }
@@ -0,0 +1,33 @@
+/**
+ * @file    AllocationCounter.h
+ * @brief   Counts heap allocations (malloc/calloc/realloc and operator new are interposed by AllocationCounter.cpp)
+ *
+ *   AllocationCounter counter;
+ *   ...the operation being measured...
+ *   EXPECT_EQ(0u,counter.allocations());
+ */
+
+#ifndef __ALLOCATION_COUNTER_H__
+#define __ALLOCATION_COUNTER_H__
+
+#include <stdint.h>
+
+// allocations made by the whole process / by the calling thread since it started
+uint64_t process_allocation_count();
+uint64_t process_allocated_bytes();
+uint64_t thread_allocation_count();
+uint64_t thread_allocated_bytes();
+
+// allocations made by the calling thread since construction (background threads are not counted)
+class AllocationCounter {
+public:
+    AllocationCounter() : m_start_allocations(thread_allocation_count()), m_start_bytes(thread_allocated_bytes()) {}
+    uint64_t allocations() const { return thread_allocation_count() - this->m_start_allocations; }
+    uint64_t allocatedBytes() const { return thread_allocated_bytes() - this->m_start_bytes; }
+
+private:
+    uint64_t m_start_allocations;
+    uint64_t m_start_bytes;
+};
+
+#endif // __ALLOCATION_COUNTER_H__
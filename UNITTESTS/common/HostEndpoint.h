@@ -0,0 +1,54 @@
+/**
+ * @file    HostEndpoint.h
+ * @brief   Builds a Connector::Endpoint on the host the same way utils_init_endpoint()/utils_build_endpoint() do
+ */
+
+#ifndef __HOST_ENDPOINT_H__
+#define __HOST_ENDPOINT_H__
+
+#include "mbed-connector-interface/ConnectorEndpoint.h"
+#include "mbed-connector-interface/DynamicResource.h"
+#include "mbed-connector-interface/ObjectInstanceManager.h"
+#include "mbed-connector-interface/OptionsBuilder.h"
+
+#include <vector>
+
+// an Endpoint, its OptionsBuilder and the resources it binds (the resources are owned by the caller)
+class HostEndpoint {
+public:
+    explicit HostEndpoint(Logger *logger) : m_logger(logger) {
+        this->m_endpoint = new Connector::Endpoint(logger,(Connector::Options *)&this->m_builder);
+        this->m_builder.setEndpoint((void *)this->m_endpoint);
+        this->m_oim = new ObjectInstanceManager(logger,(void *)this->m_endpoint);
+        this->m_endpoint->setObjectInstanceManager(this->m_oim);
+    }
+    virtual ~HostEndpoint() {
+        delete this->m_endpoint;
+        delete this->m_oim;
+    }
+
+    // observers are not started on the host (the endpoint is never registered with a server)
+    Connector::OptionsBuilder &builder() { return this->m_builder; }
+    HostEndpoint &add(DynamicResource *resource) { this->m_builder.addResource(resource,false); return *this; }
+
+    // bind every resource added so far (Endpoint::buildEndpoint())
+    Connector::Endpoint *build() {
+        this->m_endpoint->setOptions(this->m_builder.build());
+        this->m_endpoint->buildEndpoint();
+        return this->m_endpoint;
+    }
+
+    // registration state as reported by mbed-cloud-client
+    void registered() { this->m_endpoint->object_registered((void *)NULL,(void *)NULL); }
+    void unregistered() { this->m_endpoint->object_unregistered((M2MSecurity *)NULL); }
+
+    Connector::Endpoint *endpoint() { return this->m_endpoint; }
+
+private:
+    Logger                    *m_logger;
+    Connector::OptionsBuilder  m_builder;
+    Connector::Endpoint       *m_endpoint;
+    ObjectInstanceManager     *m_oim;
+};
+
+#endif // __HOST_ENDPOINT_H__
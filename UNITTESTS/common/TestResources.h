@@ -0,0 +1,44 @@
+/**
+ * @file    TestResources.h
+ * @brief   DynamicResource implementations used by the host unit tests and benchmarks
+ */
+
+#ifndef __TEST_RESOURCES_H__
+#define __TEST_RESOURCES_H__
+
+#include "mbed-connector-interface/DynamicResource.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string>
+
+// GET returns a settable value, PUT/POST/DELETE are counted
+class CountingResource : public DynamicResource {
+public:
+    CountingResource(const Logger *logger,const char *obj_name,const char *res_name,uint8_t res_mask = M2MBase::GET_PUT_POST_DELETE_ALLOWED,bool observable = true)
+        : DynamicResource(logger,obj_name,res_name,"CountingResource",res_mask,observable),
+          m_current("0"), m_gets(0), m_puts(0), m_posts(0), m_deletes(0) {}
+
+    virtual string get() { ++this->m_gets; return this->m_current; }
+    virtual void put(const string value) { ++this->m_puts; this->m_last_put = value; }
+    virtual void post(void * /* args */) { ++this->m_posts; }
+    virtual void del(void * /* args */) { ++this->m_deletes; }
+
+    void setCurrent(const std::string &value) { this->m_current = value; }
+
+    std::string       m_current;
+    std::string       m_last_put;
+    std::atomic<int>  m_gets;
+    std::atomic<int>  m_puts;
+    std::atomic<int>  m_posts;
+    std::atomic<int>  m_deletes;
+};
+
+// formats "<base><index>" (e.g. resource names for endpoints with many resources)
+inline std::string indexed_name(const char *base,int index) {
+    char buffer[32];
+    snprintf(buffer,sizeof(buffer),"%s%d",base,index);
+    return std::string(buffer);
+}
+
+#endif // __TEST_RESOURCES_H__
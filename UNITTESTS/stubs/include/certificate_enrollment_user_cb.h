@@ -0,0 +1,2 @@
+// certificate_enrollment_user_cb.h: host stand-in (intentionally empty)
+#pragma once
@@ -0,0 +1,2 @@
+// factory_configurator_client.h: host stand-in (intentionally empty)
+#pragma once
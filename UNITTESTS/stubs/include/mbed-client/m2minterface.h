@@ -0,0 +1,2 @@
+// m2minterface.h: host stand-in (see m2mresource.h)
+#include "mbed-client/m2mresource.h"
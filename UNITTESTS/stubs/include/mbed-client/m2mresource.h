@@ -0,0 +1,170 @@
+/**
+ * @file    m2mresource.h
+ * @brief   Host stand-in for the mbed-client object model used by mbedConnectorInterface (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Objects own their instances and instances own their resources. Resource values are copied on set_value() and
+ * set_value() calls are counted (each one is a notification on a real client).
+ */
+
+#ifndef __UNITTESTS_M2MRESOURCE_H__
+#define __UNITTESTS_M2MRESOURCE_H__
+
+#include "mbed.h"
+
+typedef std::string String;
+
+class M2MBase {
+public:
+    typedef enum { Object = 0x0, Resource = 0x1, ObjectInstance = 0x2, ResourceInstance = 0x3, ObjectDirectory = 0x4 } BaseType;
+    typedef enum {
+        NOT_ALLOWED = 0x00, GET_ALLOWED = 0x01, PUT_ALLOWED = 0x02, GET_PUT_ALLOWED = 0x03, POST_ALLOWED = 0x04,
+        GET_POST_ALLOWED = 0x05, PUT_POST_ALLOWED = 0x06, GET_PUT_POST_ALLOWED = 0x07, DELETE_ALLOWED = 0x08,
+        GET_DELETE_ALLOWED = 0x09, PUT_DELETE_ALLOWED = 0x0A, GET_PUT_DELETE_ALLOWED = 0x0B, POST_DELETE_ALLOWED = 0x0C,
+        GET_POST_DELETE_ALLOWED = 0x0D, PUT_POST_DELETE_ALLOWED = 0x0E, GET_PUT_POST_DELETE_ALLOWED = 0x0F
+    } Operation;
+
+    M2MBase(const String &name = "",BaseType type = Resource) : m_name(name),m_type(type),m_operation(GET_ALLOWED) {}
+    virtual ~M2MBase() {}
+    const char *name() const { return this->m_name.c_str(); }
+    Operation operation() const { return this->m_operation; }
+    void set_operation(Operation operation) { this->m_operation = operation; }
+    BaseType base_type() const { return this->m_type; }
+private:
+    String      m_name;
+    BaseType    m_type;
+    Operation   m_operation;
+};
+
+typedef mbed::Callback<void(void *)> execute_callback;
+
+class M2MResourceInstance : public M2MBase {
+public:
+    typedef enum { STRING, INTEGER, FLOAT, BOOLEAN, OPAQUE, TIME, OBJLINK } ResourceType;
+
+    M2MResourceInstance(const String &name = "",ResourceType type = STRING) : M2MBase(name,Resource),m_resource_type(type),m_set_value_count(0) {}
+    bool set_value(const uint8_t *value,const uint32_t value_length) {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        this->m_value.assign(value,value + ((value != NULL) ? value_length : 0));
+        ++this->m_set_value_count;
+        return true;
+    }
+    bool set_value(int64_t value) {
+        char buffer[24];
+        int length = snprintf(buffer,sizeof(buffer),"%lld",(long long)value);
+        return this->set_value((const uint8_t *)buffer,(uint32_t)length);
+    }
+    uint8_t *value() const { return this->m_value.empty() ? NULL : (uint8_t *)&this->m_value[0]; }
+    uint32_t value_length() const { return (uint32_t)this->m_value.size(); }
+    ResourceType resource_instance_type() const { return this->m_resource_type; }
+    bool set_execute_function(execute_callback callback) { this->m_execute = callback; return true; }
+    void execute(void *arguments) { if (this->m_execute) this->m_execute(arguments); }
+
+    // test support
+    std::string valueString() const { std::lock_guard<std::mutex> lock(this->m_lock); return std::string(this->m_value.begin(),this->m_value.end()); }
+    uint32_t setValueCount() const { return this->m_set_value_count; }
+private:
+    ResourceType            m_resource_type;
+    std::vector<uint8_t>    m_value;
+    mutable std::mutex      m_lock;
+    volatile uint32_t       m_set_value_count;
+    execute_callback        m_execute;
+};
+
+class M2MResource : public M2MResourceInstance {
+public:
+    class M2MExecuteParameter {
+    public:
+        M2MExecuteParameter(const String &object_name = "",uint16_t instance_id = 0,const String &resource_name = "",const uint8_t *value = NULL,uint16_t value_length = 0) :
+            m_object_name(object_name),m_instance_id(instance_id),m_resource_name(resource_name),m_value(value,value + ((value != NULL) ? value_length : 0)) {}
+        const String &get_argument_object_name() const { return this->m_object_name; }
+        uint16_t get_argument_object_instance_id() const { return this->m_instance_id; }
+        const String &get_argument_resource_name() const { return this->m_resource_name; }
+        uint8_t *get_argument_value() const { return this->m_value.empty() ? NULL : (uint8_t *)&this->m_value[0]; }
+        uint16_t get_argument_value_length() const { return (uint16_t)this->m_value.size(); }
+    private:
+        String                  m_object_name;
+        uint16_t                m_instance_id;
+        String                  m_resource_name;
+        std::vector<uint8_t>    m_value;
+    };
+
+    M2MResource(const String &name = "",ResourceType type = STRING,bool observable = false) : M2MResourceInstance(name,type),m_observable(observable) {}
+    bool is_observable() const { return this->m_observable; }
+private:
+    bool m_observable;
+};
+
+class M2MObjectInstance : public M2MBase {
+public:
+    M2MObjectInstance(uint16_t id = 0) : M2MBase("",ObjectInstance),m_id(id) {}
+    virtual ~M2MObjectInstance() { for (size_t i = 0; i < this->m_resources.size(); ++i) delete this->m_resources[i]; }
+    M2MResource *create_dynamic_resource(const String &name,const String & /* type */,M2MResourceInstance::ResourceType type,bool observable) {
+        M2MResource *resource = new M2MResource(name,type,observable);
+        this->m_resources.push_back(resource);
+        return resource;
+    }
+    M2MResource *create_static_resource(const String &name,const String & /* type */,M2MResourceInstance::ResourceType type,const uint8_t *value,uint8_t value_length) {
+        M2MResource *resource = new M2MResource(name,type,false);
+        resource->set_value(value,value_length);
+        this->m_resources.push_back(resource);
+        return resource;
+    }
+    uint16_t instance_id() const { return this->m_id; }
+    const std::vector<M2MResource *> &resources() const { return this->m_resources; }
+private:
+    uint16_t                    m_id;
+    std::vector<M2MResource *>  m_resources;
+};
+
+class M2MObject : public M2MBase {
+public:
+    M2MObject(const String &name = "") : M2MBase(name,Object) {}
+    virtual ~M2MObject() { for (size_t i = 0; i < this->m_instances.size(); ++i) delete this->m_instances[i]; }
+    M2MObjectInstance *create_object_instance(uint16_t id = 0xFFFF) {
+        M2MObjectInstance *instance = new M2MObjectInstance((id == 0xFFFF) ? (uint16_t)this->m_instances.size() : id);
+        this->m_instances.push_back(instance);
+        return instance;
+    }
+    const std::vector<M2MObjectInstance *> &instances() const { return this->m_instances; }
+private:
+    std::vector<M2MObjectInstance *> m_instances;
+};
+
+typedef std::vector<M2MObject *> M2MObjectList;
+
+class M2MSecurity {};
+class M2MServer {};
+
+class M2MInterface {
+public:
+    typedef enum { ErrorNone, AlreadyExists, BootstrapFailed, InvalidParameters, NotRegistered, Timeout, NetworkError, ResponseParseFailed, UnknownError, MemoryFail, NotAllowed } Error;
+};
+
+class M2MInterfaceObserver {
+public:
+    virtual ~M2MInterfaceObserver() {}
+};
+
+class M2MInterfaceFactory {
+public:
+    static M2MObject *create_object(const String &name) { return new M2MObject(name); }
+};
+
+#endif // __UNITTESTS_M2MRESOURCE_H__
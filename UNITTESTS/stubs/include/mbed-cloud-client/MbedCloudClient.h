@@ -0,0 +1,62 @@
+/**
+ * @file    MbedCloudClient.h
+ * @brief   Host stand-in for the MbedCloudClient API used by mbedConnectorInterface (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * setup() never registers: tests drive registration through the Endpoint callbacks directly.
+ */
+
+#ifndef __UNITTESTS_MBED_CLOUD_CLIENT_H__
+#define __UNITTESTS_MBED_CLOUD_CLIENT_H__
+
+#include "mbed-client/m2mresource.h"
+
+class MbedCloudClientCallback {
+public:
+    virtual ~MbedCloudClientCallback() {}
+    virtual void value_updated(M2MBase *base,M2MBase::BaseType type) = 0;
+};
+
+class MbedCloudClient {
+public:
+    typedef enum {
+        ConnectErrorNone, ConnectAlreadyExists, ConnectBootstrapFailed, ConnectInvalidParameters, ConnectNotRegistered,
+        ConnectTimeout, ConnectNetworkError, ConnectResponseParseFailed, ConnectUnknownError, ConnectMemoryConnectFail,
+        ConnectNotAllowed, ConnectSecureConnectionFailed, ConnectDnsResolvingFailed
+    } Error;
+
+    void on_registered(void (*cb)(void)) { this->m_registered = cb; }
+    void on_unregistered(void (*cb)(void)) { this->m_unregistered = cb; }
+    void on_error(void (*cb)(int)) { this->m_error = cb; }
+    void set_update_callback(MbedCloudClientCallback *callback) { this->m_callback = callback; }
+    void add_objects(const M2MObjectList &objects) { this->m_objects.insert(this->m_objects.end(),objects.begin(),objects.end()); }
+    bool setup(void * /* iface */) { ++this->setup_calls; return true; }
+    void close() {}
+
+    // test controls
+    volatile int            setup_calls = 0;
+private:
+    void                    (*m_registered)(void) = NULL;
+    void                    (*m_unregistered)(void) = NULL;
+    void                    (*m_error)(int) = NULL;
+    MbedCloudClientCallback *m_callback = NULL;
+    M2MObjectList            m_objects;
+};
+
+#endif // __UNITTESTS_MBED_CLOUD_CLIENT_H__
@@ -0,0 +1,2 @@
+// mbed-trace-helper.h: host stand-in (intentionally empty)
+#pragma once
@@ -0,0 +1,2 @@
+// mbed_trace.h: host stand-in (intentionally empty)
+#pragma once
@@ -0,0 +1,434 @@
+/**
+ * @file    mbed.h
+ * @brief   Host stand-in for the mbed OS 5 driver and RTOS APIs used by mbedConnectorInterface (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Threads are std::threads, timers (Ticker/Timeout) fire from a helper thread (core_util_is_isr_active() is true while
+ * their callbacks run) and the kernel clock is std::chrono::steady_clock. Thread::terminate() cannot kill a host thread:
+ * it detaches it and the thread exits at its next (or current) ThisThread sleep.
+ */
+
+#ifndef __UNITTESTS_MBED_H__
+#define __UNITTESTS_MBED_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+
+using namespace std;
+
+// pins
+typedef int PinName;
+#define USBTX           0
+#define USBRX           1
+#define NC              (-1)
+
+extern "C" {
+    uint32_t us_ticker_read(void);
+    void     core_util_critical_section_enter(void);
+    void     core_util_critical_section_exit(void);
+    bool     core_util_is_isr_active(void);
+    bool     core_util_atomic_cas_u32(volatile uint32_t *ptr,uint32_t *expected,uint32_t desired);
+    uint32_t core_util_atomic_incr_u32(volatile uint32_t *valuePtr,uint32_t delta);
+    uint32_t core_util_atomic_decr_u32(volatile uint32_t *valuePtr,uint32_t delta);
+    bool     core_util_atomic_cas_u8(volatile uint8_t *ptr,uint8_t *expected,uint8_t desired);
+    bool     core_util_atomic_cas_ptr(void * volatile *ptr,void **expected,void *desired);
+    void     NVIC_SystemReset(void);
+}
+
+typedef uint64_t us_timestamp_t;
+#define __DMB()         __sync_synchronize()
+
+namespace mbed {
+
+template <typename F> class Callback;
+
+// Callback: std::function backed
+template <typename R, typename... A> class Callback<R(A...)> {
+public:
+    Callback() {}
+    Callback(R (*f)(A...)) { if (f != NULL) this->m_f = f; }
+    template <typename T, typename M> Callback(T *obj,M method) {
+        this->m_f = [obj,method](A... a) -> R { return (obj->*method)(a...); };
+    }
+    R call(A... a) const { return this->m_f(a...); }
+    R operator()(A... a) const { return this->m_f(a...); }
+    operator bool() const { return (bool)this->m_f; }
+private:
+    std::function<R(A...)> m_f;
+};
+
+template <typename T, typename R, typename... A> Callback<R(A...)> callback(T *obj,R (T::*method)(A...)) { return Callback<R(A...)>(obj,method); }
+template <typename R, typename... A> Callback<R(A...)> callback(R (*f)(A...)) { return Callback<R(A...)>(f); }
+
+// FileHandle/Serial: output is counted and (optionally) captured
+class FileHandle {
+public:
+    virtual ~FileHandle() {}
+    ssize_t write(const void *buffer,size_t length) { this->emit((const char *)buffer,length); return (ssize_t)length; }
+    size_t bytesWritten() const { return this->m_bytes; }
+    void capture(bool enable) { this->m_capture = enable; this->m_output.clear(); }
+    const std::string &output() const { return this->m_output; }
+protected:
+    void emit(const char *data,size_t length) {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        this->m_bytes += length;
+        if (this->m_capture) this->m_output.append(data,length);
+    }
+private:
+    std::mutex  m_lock;
+    size_t      m_bytes = 0;
+    bool        m_capture = false;
+    std::string m_output;
+};
+
+class Serial : public FileHandle {
+public:
+    Serial(PinName /* tx */,PinName /* rx */,int /* baud */ = 9600) {}
+    int printf(const char *format,...) {
+        char buffer[4096];
+        va_list args;
+        va_start(args,format);
+        int length = vsnprintf(buffer,sizeof(buffer),format,args);
+        va_end(args);
+        if (length > (int)sizeof(buffer) - 1) length = (int)sizeof(buffer) - 1;
+        if (length > 0) this->emit(buffer,length);
+        return length;
+    }
+    int putc(int c) { char ch = (char)c; this->emit(&ch,1); return c; }
+};
+
+// Ticker/Timeout: fire from a helper thread (a new attach or detach cancels the previous schedule)
+class Ticker {
+public:
+    Ticker() : m_state(new State()) {}
+    virtual ~Ticker() { this->detach(); }
+    void attach(Callback<void()> func,float seconds) { this->attach_us(func,(us_timestamp_t)(seconds * 1000000.0f)); }
+    template <typename T, typename M> void attach(T *obj,M method,float seconds) { this->attach(Callback<void()>(obj,method),seconds); }
+    void attach_us(Callback<void()> func,us_timestamp_t us);
+    void detach();
+protected:
+    bool m_repeat = true;
+private:
+    struct State {
+        std::mutex              lock;
+        std::condition_variable changed;
+        uint64_t                generation = 0;
+    };
+    std::shared_ptr<State> m_state;
+};
+
+class Timeout : public Ticker {
+public:
+    Timeout() { this->m_repeat = false; }
+};
+
+class Timer {
+public:
+    void start() { if (!this->m_running) { this->m_start = us_ticker_read(); this->m_running = true; } }
+    void stop() { if (this->m_running) { this->m_elapsed += us_ticker_read() - this->m_start; this->m_running = false; } }
+    void reset() { this->m_elapsed = 0; this->m_start = us_ticker_read(); }
+    int read_us() { return (int)(this->m_elapsed + (this->m_running ? (us_ticker_read() - this->m_start) : 0)); }
+    int read_ms() { return this->read_us() / 1000; }
+    float read() { return this->read_us() / 1000000.0f; }
+private:
+    uint32_t m_start = 0;
+    uint64_t m_elapsed = 0;
+    bool     m_running = false;
+};
+
+class InterruptIn {
+public:
+    InterruptIn(PinName) {}
+    void fall(Callback<void()>) {}
+    void rise(Callback<void()>) {}
+};
+
+class DigitalOut {
+public:
+    DigitalOut(PinName,int value = 0) : m_value(value) {}
+    void write(int value) { this->m_value = value; }
+    int read() { return this->m_value; }
+private:
+    int m_value;
+};
+
+} // namespace mbed
+
+using namespace mbed;
+
+// RTOS
+typedef int osStatus;
+typedef int osPriority;
+#define osOK                    0
+#define osErrorResource         (-3)
+#define osWaitForever           0xFFFFFFFFU
+#define osFlagsError            0x80000000U
+#define osFlagsErrorTimeout     0xFFFFFFFEU
+enum {
+    osPriorityIdle = 1,
+    osPriorityLow = 8,
+    osPriorityBelowNormal = 16,
+    osPriorityNormal = 24,
+    osPriorityAboveNormal = 32,
+    osPriorityHigh = 40,
+    osPriorityRealtime = 48
+};
+
+typedef void *osThreadId_t;
+
+namespace rtos {
+
+namespace Kernel {
+    uint64_t get_ms_count();
+}
+
+namespace ThisThread {
+    void sleep_for(uint32_t ms);
+    void sleep_until(uint64_t ms);
+    void yield();
+    osThreadId_t get_id();
+}
+
+// a terminate() request shared by a Thread and its host thread (which may outlive the Thread)
+struct ThreadControl {
+    std::mutex              lock;
+    std::condition_variable changed;
+    bool                    terminated = false;
+};
+
+// Thread: std::thread backed (priority and stack size are ignored)
+class Thread {
+public:
+    Thread(osPriority /* priority */ = osPriorityNormal,uint32_t /* stack_size */ = 4096,unsigned char * /* stack_mem */ = NULL,const char * /* name */ = NULL) : m_control(new ThreadControl()) {}
+    virtual ~Thread() { if (this->m_thread.joinable()) this->m_thread.detach(); }
+    osStatus start(mbed::Callback<void()> task) {
+        if (this->m_thread.joinable()) return osErrorResource;
+        std::atomic<osThreadId_t> *id = &this->m_id;
+        std::shared_ptr<ThreadControl> control = this->m_control;
+        ++Thread::started();
+        this->m_thread = std::thread([task,id,control]() { id->store(ThisThread::get_id()); Thread::run(control,task); });
+        return osOK;
+    }
+    osThreadId_t get_id() const { return this->m_id.load(); }
+    // test controls: threads started so far (detects duplicate background threads)
+    static std::atomic<int> &started() { static std::atomic<int> count(0); return count; }
+    osStatus join() {
+        if (this->m_thread.joinable() && this->m_thread.get_id() != std::this_thread::get_id()) this->m_thread.join();
+        return osOK;
+    }
+    osStatus terminate() {
+        // a host thread cannot be killed... it is detached and leaves at its next ThisThread sleep
+        {
+            std::lock_guard<std::mutex> lock(this->m_control->lock);
+            this->m_control->terminated = true;
+            this->m_control->changed.notify_all();
+        }
+        if (this->m_thread.joinable()) this->m_thread.detach();
+        return osOK;
+    }
+private:
+    static void run(std::shared_ptr<ThreadControl> control,mbed::Callback<void()> task);
+    std::shared_ptr<ThreadControl> m_control;
+    std::thread               m_thread;
+    std::atomic<osThreadId_t> m_id { NULL };
+};
+
+// Mutex: recursive (as in mbed OS)
+class Mutex {
+public:
+    void lock() { this->m_mutex.lock(); }
+    void unlock() { this->m_mutex.unlock(); }
+    bool trylock() { return this->m_mutex.try_lock(); }
+private:
+    std::recursive_mutex m_mutex;
+};
+
+class Semaphore {
+public:
+    Semaphore(int32_t count = 0) : m_count(count),m_max(0x7FFFFFFF) {}
+    Semaphore(int32_t count,uint16_t max_count) : m_count(count),m_max(max_count) {}
+    // mbed OS 5: tokens available before this acquire (0 - timed out)
+    int32_t wait(uint32_t millisec = osWaitForever) {
+        std::unique_lock<std::mutex> lock(this->m_lock);
+        if (millisec == osWaitForever) {
+            this->m_changed.wait(lock,[this]() { return this->m_count > 0; });
+        }
+        else if (!this->m_changed.wait_for(lock,std::chrono::milliseconds(millisec),[this]() { return this->m_count > 0; })) {
+            return 0;
+        }
+        return this->m_count--;
+    }
+    void acquire() { this->wait(osWaitForever); }
+    bool try_acquire() { return this->wait(0) > 0; }
+    bool try_acquire_for(uint32_t millisec) { return this->wait(millisec) > 0; }
+    osStatus release() {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        if (this->m_count >= this->m_max) return osErrorResource;
+        ++this->m_count;
+        this->m_changed.notify_one();
+        return osOK;
+    }
+private:
+    std::mutex              m_lock;
+    std::condition_variable m_changed;
+    int32_t                 m_count;
+    int32_t                 m_max;
+};
+
+class EventFlags {
+public:
+    EventFlags(const char * /* name */ = NULL) {}
+    uint32_t set(uint32_t flags) {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        this->m_flags |= flags;
+        this->m_changed.notify_all();
+        return this->m_flags;
+    }
+    uint32_t clear(uint32_t flags = 0x7FFFFFFF) {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        uint32_t previous = this->m_flags;
+        this->m_flags &= ~flags;
+        return previous;
+    }
+    uint32_t get() const { return this->m_flags; }
+    uint32_t wait_any(uint32_t flags,uint32_t millisec = osWaitForever,bool clear = true) { return this->wait(flags,millisec,clear,false); }
+    uint32_t wait_all(uint32_t flags,uint32_t millisec = osWaitForever,bool clear = true) { return this->wait(flags,millisec,clear,true); }
+private:
+    uint32_t wait(uint32_t flags,uint32_t millisec,bool clear,bool all) {
+        std::unique_lock<std::mutex> lock(this->m_lock);
+        auto ready = [&]() { return all ? ((this->m_flags & flags) == flags) : ((this->m_flags & flags) != 0); };
+        if (millisec == osWaitForever) {
+            this->m_changed.wait(lock,ready);
+        }
+        else if (!this->m_changed.wait_for(lock,std::chrono::milliseconds(millisec),ready)) {
+            return osFlagsErrorTimeout;
+        }
+        uint32_t result = this->m_flags;
+        if (clear) this->m_flags &= ~flags;
+        return result;
+    }
+    std::mutex              m_lock;
+    std::condition_variable m_changed;
+    volatile uint32_t       m_flags = 0;
+};
+
+} // namespace rtos
+
+using namespace rtos;
+
+// events: calls are dispatched (earliest deadline first) by whichever thread runs dispatch()/dispatch_forever()
+#define EVENTS_EVENT_SIZE   40
+namespace events {
+class EventQueue {
+public:
+    // room for size/EVENTS_EVENT_SIZE pending calls (a full queue returns id 0, as mbed OS does when out of memory)
+    EventQueue(unsigned size = 32 * EVENTS_EVENT_SIZE,unsigned char * /* buffer */ = NULL) : m_capacity(size / EVENTS_EVENT_SIZE) {}
+    template <typename F> int call(F func) { return this->post(0,-1,mbed::Callback<void()>(func)); }
+    template <typename F> int call_in(int ms,F func) { return this->post(ms,-1,mbed::Callback<void()>(func)); }
+    template <typename F> int call_every(int ms,F func) { return this->post(ms,ms,mbed::Callback<void()>(func)); }
+    void cancel(int id);
+    void dispatch(int ms = -1);
+    void dispatch_forever() { this->dispatch(-1); }
+    void break_dispatch();
+private:
+    struct Event {
+        int                   id;
+        uint64_t              due_ms;
+        int                   period_ms;   // -1 - one shot
+        mbed::Callback<void()> func;
+    };
+    int post(int delay_ms,int period_ms,mbed::Callback<void()> func);
+    std::mutex              m_lock;
+    std::condition_variable m_changed;
+    std::vector<Event>      m_events;
+    unsigned                m_capacity;
+    int                     m_id = 0;
+    bool                    m_break = false;
+};
+}
+using namespace events;
+
+// networking
+typedef int nsapi_error_t;
+typedef int nsapi_event_t;
+typedef int nsapi_connection_status_t;
+#define NSAPI_ERROR_OK                          0
+#define NSAPI_ERROR_WOULD_BLOCK                 (-3001)
+#define NSAPI_ERROR_NO_CONNECTION               (-3004)
+#define NSAPI_ERROR_ALREADY                     (-3014)
+#define NSAPI_ERROR_IS_CONNECTED                (-3015)
+#define NSAPI_ERROR_BUSY                        (-3020)
+#define NSAPI_EVENT_CONNECTION_STATUS_CHANGE    0
+#define NSAPI_STATUS_LOCAL_UP                   0
+#define NSAPI_STATUS_GLOBAL_UP                  1
+#define NSAPI_STATUS_DISCONNECTED               2
+#define NSAPI_STATUS_CONNECTING                 3
+
+// NetworkInterface: connect() results and delays are scriptable from tests
+class NetworkInterface {
+public:
+    virtual ~NetworkInterface() {}
+    static NetworkInterface *get_default_instance();
+    virtual nsapi_error_t connect() {
+        ++this->connect_calls;
+        if (this->connect_delay_ms > 0) rtos::ThisThread::sleep_for(this->connect_delay_ms);
+        nsapi_error_t result = this->connect_result;
+        if (result == NSAPI_ERROR_OK) this->report(NSAPI_STATUS_GLOBAL_UP);
+        return result;
+    }
+    virtual nsapi_error_t disconnect() { this->report(NSAPI_STATUS_DISCONNECTED); return NSAPI_ERROR_OK; }
+    virtual nsapi_error_t set_blocking(bool blocking) { this->blocking = blocking; return NSAPI_ERROR_OK; }
+    const char *get_ip_address() { return (this->status == NSAPI_STATUS_GLOBAL_UP) ? "127.0.0.1" : NULL; }
+    void attach(mbed::Callback<void(nsapi_event_t,intptr_t)> status_cb) { this->m_status_cb = status_cb; }
+    nsapi_connection_status_t get_connection_status() const { return this->status; }
+
+    // test controls
+    void report(nsapi_connection_status_t new_status) {
+        this->status = new_status;
+        if (this->m_status_cb) this->m_status_cb(NSAPI_EVENT_CONNECTION_STATUS_CHANGE,(intptr_t)new_status);
+    }
+    volatile nsapi_error_t      connect_result = NSAPI_ERROR_OK;
+    uint32_t                    connect_delay_ms = 0;
+    volatile int                connect_calls = 0;
+    bool                        blocking = true;
+    volatile nsapi_connection_status_t status = NSAPI_STATUS_DISCONNECTED;
+private:
+    mbed::Callback<void(nsapi_event_t,intptr_t)> m_status_cb;
+};
+
+class BlockDevice {
+public:
+    static BlockDevice *get_default_instance();
+};
+
+#define MBED_CONF_APP_SHUTDOWN_BUTTON_ENABLE    false
+
+#endif // __UNITTESTS_MBED_H__
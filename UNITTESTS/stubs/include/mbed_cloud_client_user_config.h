@@ -0,0 +1,2 @@
+// mbed_cloud_client_user_config.h: host stand-in (intentionally empty)
+#pragma once
@@ -0,0 +1,2 @@
+// mbed_events.h: host stand-in (see mbed.h)
+#include "mbed.h"
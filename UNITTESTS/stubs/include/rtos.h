@@ -0,0 +1,2 @@
+// rtos.h: host stand-in (see mbed.h)
+#include "mbed.h"
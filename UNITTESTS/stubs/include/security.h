@@ -0,0 +1,3 @@
+// security.h: host stand-in for the application supplied security credentials
+#pragma once
+#include "mbed-cloud-client/MbedCloudClient.h"
@@ -0,0 +1,2 @@
+// update_ui_example.h: host stand-in (intentionally empty)
+#pragma once
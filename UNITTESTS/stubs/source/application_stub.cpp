@@ -0,0 +1,32 @@
+/**
+ * @file    application_stub.cpp
+ * @brief   Host stand-in for the application supplied logger and endpoint configuration (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbed-connector-interface/mbedEndpointNetwork.h"
+
+// the application's serial port and logger
+Serial pc(USBTX,USBRX);
+Logger logger(&pc);
+
+// the application's endpoint configuration (the default options)
+Connector::Options *configure_endpoint(Connector::OptionsBuilder &builder) {
+    return builder.build();
+}
@@ -0,0 +1,258 @@
+/**
+ * @file    mbed_stub.cpp
+ * @brief   Host stand-in implementation of the mbed OS 5 platform, timer and RTOS functions (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbed.h"
+
+// all host timing is relative to process start
+static const std::chrono::steady_clock::time_point s_epoch = std::chrono::steady_clock::now();
+
+// critical sections: one process wide recursive lock
+static std::recursive_mutex s_critical;
+
+// true while a Ticker/Timeout callback runs (their callbacks are "interrupts")
+static thread_local bool s_in_isr = false;
+
+// the terminate() request of the Thread running on this host thread (NULL - not a Thread)
+static thread_local ThreadControl *s_thread_control = NULL;
+
+// unwinds a terminated Thread's task from its ThisThread sleep
+struct ThreadTerminated {};
+
+// the default network interface
+static NetworkInterface s_network_interface;
+
+extern "C" {
+
+uint32_t us_ticker_read(void) {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+void core_util_critical_section_enter(void) {
+    s_critical.lock();
+}
+
+void core_util_critical_section_exit(void) {
+    s_critical.unlock();
+}
+
+bool core_util_is_isr_active(void) {
+    return s_in_isr;
+}
+
+bool core_util_atomic_cas_u32(volatile uint32_t *ptr,uint32_t *expected,uint32_t desired) {
+    return __atomic_compare_exchange_n(ptr,expected,desired,false,__ATOMIC_SEQ_CST,__ATOMIC_SEQ_CST);
+}
+
+bool core_util_atomic_cas_u8(volatile uint8_t *ptr,uint8_t *expected,uint8_t desired) {
+    return __atomic_compare_exchange_n(ptr,expected,desired,false,__ATOMIC_SEQ_CST,__ATOMIC_SEQ_CST);
+}
+
+bool core_util_atomic_cas_ptr(void * volatile *ptr,void **expected,void *desired) {
+    return __atomic_compare_exchange_n(ptr,expected,desired,false,__ATOMIC_SEQ_CST,__ATOMIC_SEQ_CST);
+}
+
+uint32_t core_util_atomic_incr_u32(volatile uint32_t *valuePtr,uint32_t delta) {
+    return __atomic_add_fetch(valuePtr,delta,__ATOMIC_SEQ_CST);
+}
+
+uint32_t core_util_atomic_decr_u32(volatile uint32_t *valuePtr,uint32_t delta) {
+    return __atomic_sub_fetch(valuePtr,delta,__ATOMIC_SEQ_CST);
+}
+
+void NVIC_SystemReset(void) {
+    // not on the host
+}
+
+} // extern "C"
+
+namespace rtos {
+
+uint64_t Kernel::get_ms_count() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+// sleep... a Thread that is (or gets) terminated leaves here instead
+static void sleep_until_time(std::chrono::steady_clock::time_point deadline) {
+    if (s_thread_control == NULL) {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+    std::unique_lock<std::mutex> lock(s_thread_control->lock);
+    if (s_thread_control->changed.wait_until(lock,deadline,[]() { return s_thread_control->terminated; })) {
+        throw ThreadTerminated();
+    }
+}
+
+void ThisThread::sleep_for(uint32_t ms) {
+    sleep_until_time(std::chrono::steady_clock::now() + std::chrono::milliseconds(ms));
+}
+
+void ThisThread::sleep_until(uint64_t ms) {
+    sleep_until_time(s_epoch + std::chrono::milliseconds(ms));
+}
+
+void ThisThread::yield() {
+    std::this_thread::yield();
+}
+
+osThreadId_t ThisThread::get_id() {
+    static thread_local char marker;
+    return (osThreadId_t)&marker;
+}
+
+// run a Thread's task (until it returns or is terminated)
+void Thread::run(std::shared_ptr<ThreadControl> control,mbed::Callback<void()> task) {
+    s_thread_control = control.get();
+    try {
+        task();
+    }
+    catch (const ThreadTerminated &) {
+        // terminate() while sleeping
+    }
+    s_thread_control = NULL;
+}
+
+} // namespace rtos
+
+namespace events {
+
+// queue a call (0 - the queue is full)
+int EventQueue::post(int delay_ms,int period_ms,mbed::Callback<void()> func) {
+    std::lock_guard<std::mutex> lock(this->m_lock);
+    if (this->m_events.size() >= this->m_capacity) {
+        return 0;
+    }
+    Event event = { ++this->m_id,Kernel::get_ms_count() + (uint64_t)delay_ms,period_ms,func };
+    this->m_events.push_back(event);
+    this->m_changed.notify_all();
+    return event.id;
+}
+
+// cancel a queued call (a call already being dispatched completes)
+void EventQueue::cancel(int id) {
+    std::lock_guard<std::mutex> lock(this->m_lock);
+    for (size_t i = 0; i < this->m_events.size(); ++i) {
+        if (this->m_events[i].id == id) {
+            this->m_events.erase(this->m_events.begin() + i);
+            this->m_changed.notify_all();
+            return;
+        }
+    }
+}
+
+// dispatch due calls for ms (-1 - until break_dispatch())
+void EventQueue::dispatch(int ms) {
+    std::unique_lock<std::mutex> lock(this->m_lock);
+    uint64_t until = (ms < 0) ? UINT64_MAX : Kernel::get_ms_count() + (uint64_t)ms;
+    while (this->m_break == false) {
+        // the earliest call
+        size_t next = this->m_events.size();
+        for (size_t i = 0; i < this->m_events.size(); ++i) {
+            if (next == this->m_events.size() || this->m_events[i].due_ms < this->m_events[next].due_ms) {
+                next = i;
+            }
+        }
+        uint64_t now = Kernel::get_ms_count();
+        if (next < this->m_events.size() && this->m_events[next].due_ms <= now) {
+            mbed::Callback<void()> func = this->m_events[next].func;
+            if (this->m_events[next].period_ms >= 0) {
+                this->m_events[next].due_ms += (uint64_t)this->m_events[next].period_ms;
+            }
+            else {
+                this->m_events.erase(this->m_events.begin() + next);
+            }
+            lock.unlock();
+            func();
+            lock.lock();
+            continue;
+        }
+        if (now >= until) {
+            break;
+        }
+        uint64_t wake = (next < this->m_events.size() && this->m_events[next].due_ms < until) ? this->m_events[next].due_ms : until;
+        if (wake == UINT64_MAX) {
+            this->m_changed.wait(lock);
+        }
+        else {
+            this->m_changed.wait_until(lock,s_epoch + std::chrono::milliseconds(wake));
+        }
+    }
+    this->m_break = false;
+}
+
+// make dispatch() return
+void EventQueue::break_dispatch() {
+    std::lock_guard<std::mutex> lock(this->m_lock);
+    this->m_break = true;
+    this->m_changed.notify_all();
+}
+
+} // namespace events
+
+namespace mbed {
+
+// (re)schedule: the helper thread fires unless the generation has moved on
+void Ticker::attach_us(Callback<void()> func,us_timestamp_t us) {
+    std::shared_ptr<State> state = this->m_state;
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(state->lock);
+        generation = ++state->generation;
+        state->changed.notify_all();
+    }
+    bool repeat = this->m_repeat;
+    std::thread([state,generation,func,us,repeat]() {
+        std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(state->lock);
+                if (state->changed.wait_until(lock,next,[&]() { return state->generation != generation; })) {
+                    return;
+                }
+            }
+            s_in_isr = true;
+            func();
+            s_in_isr = false;
+            if (!repeat) {
+                return;
+            }
+            next += std::chrono::microseconds(us);
+        }
+    }).detach();
+}
+
+// cancel any schedule
+void Ticker::detach() {
+    std::lock_guard<std::mutex> lock(this->m_state->lock);
+    ++this->m_state->generation;
+    this->m_state->changed.notify_all();
+}
+
+} // namespace mbed
+
+NetworkInterface *NetworkInterface::get_default_instance() {
+    return &s_network_interface;
+}
+
+BlockDevice *BlockDevice::get_default_instance() {
+    return NULL;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file    platform_stub.cpp
+ * @brief   Host stand-in for the mbed Cloud Client platform setup functions (UNITTESTS only)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbed.h"
+#include "mcc_common_setup.h"
+#include "application_init.h"
+
+extern "C" {
+
+int mcc_platform_init(void) {
+    return 0;
+}
+
+int mcc_platform_close_connection(void) {
+    return 0;
+}
+
+void *mcc_platform_get_network_interface(void) {
+    return (void *)NetworkInterface::get_default_instance();
+}
+
+int mcc_platform_reformat_storage(void) {
+    return 0;
+}
+
+int mcc_platform_storage_init(void) {
+    return 0;
+}
+
+void mcc_platform_do_wait(int timeout_ms) {
+    rtos::ThisThread::sleep_for(timeout_ms);
+}
+
+void mcc_platform_sw_build_info(void) {
+}
+
+int mcc_platform_run_program(main_t mainFunc) {
+    mainFunc();
+    return 0;
+}
+
+} // extern "C"
+
+bool application_init_mbed_trace(void) {
+    return true;
+}
+
+bool application_init(void) {
+    return true;
+}
+
+void print_fcc_status(int /* fcc_status */) {
+}
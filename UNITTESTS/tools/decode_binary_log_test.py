@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+#
+# @file    decode_binary_log_test.py
+# @brief   Host test: tools/decode_binary_log.py decodes the record Logger::encodeBinary() produces
+#
+# Usage:
+#   decode_binary_log_test.py <tools directory> <fixtures/binary_log_record.bin>
+#
+# The fixture holds the raw arguments Logger_test.cpp (Logger.BinaryRecordsMatchTheDecoderFixture) checks the encoder
+# against, so the encoder and the decoder are held to the same bytes.
+#
+
+import io
+import struct
+import sys
+import unittest
+
+# must match binary_format in Logger_test.cpp
+FORMAT = 'v=%d u=%u w=%lld s=%s f=%.3f L=%.2Lf c=%c\r\n'
+EXPECTED = 'v=-42 u=7 w=-5000000000 s=abc f=1.500 L=2.25 c=x\n'
+ADDRESS = 0x0800abcd
+
+
+def frame(address, payload):
+    record = struct.pack('<I', address) + payload
+    return b'\xa5\x5a' + struct.pack('<H', len(record)) + record
+
+
+class DecodeBinaryLogTest(unittest.TestCase):
+    def test_fixture_round_trips(self):
+        python_fmt, args = decode_binary_log.decode_arguments(FORMAT, FIXTURE)
+        self.assertEqual(EXPECTED, (python_fmt % args).replace('\r\n', '\n'))
+
+    def test_frames_resynchronize(self):
+        stream = io.BytesIO(b'\x00\xa5noise' + frame(ADDRESS, FIXTURE) + frame(ADDRESS + 4, b''))
+        self.assertEqual([(ADDRESS, FIXTURE), (ADDRESS + 4, b'')], list(decode_binary_log.frames(stream)))
+
+    def test_truncated_record_is_undecodable(self):
+        with self.assertRaises(struct.error):
+            decode_binary_log.decode_arguments(FORMAT, FIXTURE[:-6])
+
+
+if __name__ == '__main__':
+    sys.path.insert(0, sys.argv[1])
+    import decode_binary_log
+    with open(sys.argv[2], 'rb') as f:
+        FIXTURE = f.read()
+    unittest.main(argv=sys.argv[:1])
@@ -0,0 +1,124 @@
+/**
+ * @file    ConnectionManager_test.cpp
+ * @brief   Host unit tests for the network ConnectionManager (backoff and reconnection after link loss)
+ */
+
+#include "gtest/gtest.h"
+#include "mbed-connector-interface/ConnectionManager.h"
+
+#include <atomic>
+
+extern Logger logger;
+
+// counts link status changes reported to the main loop
+static std::atomic<int> _link_changes(0);
+static void link_changed(void) {
+    ++_link_changes;
+}
+
+// wait (bounded) for a condition set by another thread
+template <typename F> static bool eventually(F condition,uint32_t timeout_ms = 2000) {
+    uint64_t deadline = Kernel::get_ms_count() + timeout_ms;
+    while (condition() == false) {
+        if (Kernel::get_ms_count() >= deadline) {
+            return false;
+        }
+        ThisThread::sleep_for(1);
+    }
+    return true;
+}
+
+TEST(ConnectionManagerTest, GivesUpAfterMaxAttempts) {
+    NetworkInterface net;
+    net.connect_result = NSAPI_ERROR_NO_CONNECTION;
+    ConnectionManager manager(&logger,1,4,0,3);
+    EXPECT_EQ(NSAPI_ERROR_NO_CONNECTION,manager.connect(&net));
+    EXPECT_EQ(3,(int)net.connect_calls);
+    EXPECT_FALSE(manager.isConnected());
+    ConnectionManager::Statistics stats = manager.getStatistics();
+    EXPECT_EQ(3U,stats.attempts);
+    EXPECT_EQ(3U,stats.failures);
+    EXPECT_EQ(0U,stats.connects);
+}
+
+TEST(ConnectionManagerTest, ConnectsAfterFailures) {
+    NetworkInterface net;
+    net.connect_result = NSAPI_ERROR_NO_CONNECTION;
+    ConnectionManager manager(&logger,1,4,0,0);
+    Timeout restore;
+    struct Restore { NetworkInterface *net; void run() { this->net->connect_result = NSAPI_ERROR_OK; } } restorer = { &net };
+    restore.attach(callback(&restorer,&Restore::run),0.02f);
+    EXPECT_EQ(NSAPI_ERROR_OK,manager.connect(&net));
+    EXPECT_TRUE(manager.isConnected());
+    EXPECT_GT((int)net.connect_calls,1);
+    EXPECT_EQ(1U,manager.getStatistics().connects);
+}
+
+TEST(ConnectionManagerTest, StatusCallbackDoesNotBlock) {
+    NetworkInterface net;
+    ConnectionManager manager(&logger,1,4,0,0);
+    ASSERT_EQ(NSAPI_ERROR_OK,manager.connect(&net));
+
+    // reconnection is slow... the link loss report must still return at once
+    net.connect_delay_ms = 200;
+    uint64_t start = Kernel::get_ms_count();
+    net.report(NSAPI_STATUS_DISCONNECTED);
+    EXPECT_LT(Kernel::get_ms_count() - start,100U);
+    EXPECT_FALSE(manager.isConnected());
+    EXPECT_TRUE(eventually([&]() { return manager.isConnected(); }));
+}
+
+TEST(ConnectionManagerTest, ReconnectsAfterLinkLoss) {
+    NetworkInterface net;
+    ConnectionManager manager(&logger,1,4,0,0);
+    manager.attach(callback(link_changed));
+    ASSERT_EQ(NSAPI_ERROR_OK,manager.connect(&net));
+    _link_changes = 0;
+
+    net.connect_result = NSAPI_ERROR_NO_CONNECTION;
+    net.report(NSAPI_STATUS_DISCONNECTED);
+    EXPECT_TRUE(eventually([&]() { return net.connect_calls >= 4; }));
+    EXPECT_FALSE(manager.isConnected());
+    net.connect_result = NSAPI_ERROR_OK;
+    EXPECT_TRUE(eventually([&]() { return manager.isConnected(); }));
+    EXPECT_GE((int)_link_changes,2);
+
+    ConnectionManager::Statistics stats = manager.getStatistics();
+    EXPECT_EQ(1U,stats.link_losses);
+    EXPECT_EQ(2U,stats.connects);
+    EXPECT_GE(stats.failures,3U);
+}
+
+TEST(ConnectionManagerTest, FailedAttemptsAreNotLinkLosses) {
+    NetworkInterface net;
+    net.connect_result = NSAPI_ERROR_NO_CONNECTION;
+    ConnectionManager manager(&logger,1,4,0,2);
+    manager.connect(&net);
+    net.report(NSAPI_STATUS_DISCONNECTED);
+    ThisThread::sleep_for(20);
+    EXPECT_EQ(2,(int)net.connect_calls);
+    EXPECT_EQ(0U,manager.getStatistics().link_losses);
+}
+
+TEST(ConnectionManagerTest, RegistrationDelaysBackOffUntilRegistered) {
+    ConnectionManager manager(&logger,100,400,0,0);
+    EXPECT_EQ(100U,manager.nextRegistrationDelay());
+    EXPECT_EQ(200U,manager.nextRegistrationDelay());
+    EXPECT_EQ(400U,manager.nextRegistrationDelay());
+    EXPECT_EQ(400U,manager.nextRegistrationDelay());
+    manager.registrationSucceeded();
+    EXPECT_EQ(100U,manager.nextRegistrationDelay());
+}
+
+TEST(ConnectionManagerTest, RegistrationDelaysAreJittered) {
+    ConnectionManager manager(&logger,1000,1000,50,0);
+    bool varied = false;
+    uint32_t first = manager.nextRegistrationDelay();
+    for (int i = 0; i < 32; ++i) {
+        uint32_t delay_ms = manager.nextRegistrationDelay();
+        EXPECT_GE(delay_ms,500U);
+        EXPECT_LE(delay_ms,1000U);
+        if (delay_ms != first) varied = true;
+    }
+    EXPECT_TRUE(varied);
+}
@@ -0,0 +1,161 @@
+/**
+ * @file    ConnectorEndpoint_test.cpp
+ * @brief   Host unit tests for Endpoint resource binding, inbound dispatch and startup phase timing
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+#include <string.h>
+
+extern Logger logger;
+
+TEST(ConnectorEndpoint, BindCreatesOneObjectPerObjectId) {
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    CountingResource b(&logger,"3303","5701");
+    CountingResource c(&logger,"3311","5850");
+    host.add(&a).add(&b).add(&c);
+    Connector::Endpoint *ep = host.build();
+    ASSERT_NE((void *)NULL,(void *)ep->getEndpointInterface());
+    EXPECT_EQ(2u,ep->getEndpointObjectList().size());
+    EXPECT_NE((void *)NULL,a.getResource());
+    EXPECT_NE((void *)NULL,c.getResource());
+    EXPECT_EQ(std::string("3303/0/5700"),a.getFullName());
+}
+
+TEST(ConnectorEndpoint, BindRecordsInitialValue) {
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    a.setCurrent("21.5");
+    host.add(&a).build();
+    EXPECT_EQ(1,a.m_gets.load());
+    EXPECT_EQ(std::string("21.5"),((M2MResource *)a.getResource())->valueString());
+}
+
+TEST(ConnectorEndpoint, ValueUpdatedDispatchesPutToTheOwningResource) {
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    CountingResource b(&logger,"3303","5701");
+    host.add(&a).add(&b);
+    Connector::Endpoint *ep = host.build();
+    M2MResource *res = (M2MResource *)b.getResource();
+    res->set_value((const uint8_t *)"on",2);
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    ep->value_updated(res,M2MBase::Resource);
+    EXPECT_EQ(0,a.m_puts.load());
+    EXPECT_EQ(1,b.m_puts.load());
+    EXPECT_EQ(std::string("on"),b.m_last_put);
+}
+
+TEST(ConnectorEndpoint, NotifyWritesTheResourceValue) {
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    host.add(&a).build();
+    EXPECT_EQ(0,a.notify(std::string("22.0")));
+    EXPECT_EQ(std::string("22.0"),((M2MResource *)a.getResource())->valueString());
+}
+
+// records the startup phases reported to it
+class StartupRecorder : public Connector::ConnectionStatusInterface {
+public:
+    StartupRecorder() : m_completed(0), m_total_ms(0) {
+        memset(this->m_reports,0,sizeof(this->m_reports));
+        memset(this->m_completed_at,0,sizeof(this->m_completed_at));
+    }
+    virtual void startup_phase_completed(void * /* ep */,int phase,uint32_t /* duration_ms */,uint32_t completed_at_ms) {
+        ++this->m_reports[phase];
+        this->m_completed_at[phase] = completed_at_ms;
+    }
+    virtual void startup_completed(void * /* ep */,uint32_t total_ms) {
+        ++this->m_completed;
+        this->m_total_ms = total_ms;
+    }
+    int      m_reports[StartupTimer::PHASE_COUNT];
+    uint32_t m_completed_at[StartupTimer::PHASE_COUNT];
+    int      m_completed;
+    uint32_t m_total_ms;
+};
+
+TEST(ConnectorEndpoint, StartupPhasesAreTimedInOrder) {
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    host.add(&a).build();
+    StartupTimer *timer = host.endpoint()->getStartupTimer();
+    EXPECT_TRUE(timer->isComplete(StartupTimer::PHASE_PLATFORM));
+    EXPECT_TRUE(timer->isComplete(StartupTimer::PHASE_PROVISIONING));
+    EXPECT_TRUE(timer->isComplete(StartupTimer::PHASE_BIND_STATIC));
+    EXPECT_TRUE(timer->isComplete(StartupTimer::PHASE_BIND_DYNAMIC));
+    EXPECT_FALSE(timer->isComplete(StartupTimer::PHASE_BIND_DEVICE_MANAGER));
+    EXPECT_FALSE(timer->isComplete(StartupTimer::PHASE_REGISTRATION));
+    EXPECT_LE(timer->completedAt(StartupTimer::PHASE_PLATFORM),timer->completedAt(StartupTimer::PHASE_PROVISIONING));
+    EXPECT_LE(timer->completedAt(StartupTimer::PHASE_PROVISIONING),timer->completedAt(StartupTimer::PHASE_BIND_STATIC));
+    EXPECT_LE(timer->completedAt(StartupTimer::PHASE_BIND_STATIC),timer->completedAt(StartupTimer::PHASE_BIND_DYNAMIC));
+    EXPECT_LE(timer->completedAt(StartupTimer::PHASE_BIND_DYNAMIC),timer->elapsed());
+
+    // the first registration completes startup
+    host.registered();
+    EXPECT_TRUE(timer->isComplete(StartupTimer::PHASE_REGISTRATION));
+    EXPECT_LE(timer->completedAt(StartupTimer::PHASE_BIND_DYNAMIC),timer->completedAt(StartupTimer::PHASE_REGISTRATION));
+}
+
+TEST(ConnectorEndpoint, StartupPhasesAreForwardedToTheConnectionStatusInterface) {
+    StartupRecorder recorder;
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    host.endpoint()->setConnectionStatusInterfaceImpl(&recorder);
+    host.add(&a).build();
+    StartupTimer *timer = host.endpoint()->getStartupTimer();
+    EXPECT_EQ(1,recorder.m_reports[StartupTimer::PHASE_PLATFORM]);
+    EXPECT_EQ(1,recorder.m_reports[StartupTimer::PHASE_BIND_DYNAMIC]);
+    EXPECT_EQ(0,recorder.m_reports[StartupTimer::PHASE_REGISTRATION]);
+    EXPECT_EQ(timer->completedAt(StartupTimer::PHASE_BIND_DYNAMIC),recorder.m_completed_at[StartupTimer::PHASE_BIND_DYNAMIC]);
+    EXPECT_EQ(0,recorder.m_completed);
+
+    // startup completes once (later registrations are not startup)
+    host.registered();
+    host.registered();
+    EXPECT_EQ(1,recorder.m_reports[StartupTimer::PHASE_REGISTRATION]);
+    EXPECT_EQ(1,recorder.m_completed);
+    EXPECT_GE(recorder.m_total_ms,timer->completedAt(StartupTimer::PHASE_REGISTRATION));
+}
+
+TEST(ConnectorEndpoint, StartupPhasesCompletedEarlierAreReportedOnInstall) {
+    StartupRecorder recorder;
+    HostEndpoint host(&logger);
+    CountingResource a(&logger,"3303","5700");
+    host.add(&a).build();
+    host.endpoint()->setConnectionStatusInterfaceImpl(&recorder);
+    StartupTimer *timer = host.endpoint()->getStartupTimer();
+    for (int phase = 0; phase < StartupTimer::PHASE_COUNT; ++phase) {
+        EXPECT_EQ(timer->isComplete(phase) ? 1 : 0,recorder.m_reports[phase]) << StartupTimer::name(phase);
+        EXPECT_EQ(timer->completedAt(phase),recorder.m_completed_at[phase]) << StartupTimer::name(phase);
+    }
+}
+
+TEST(ConnectorEndpoint, StartupTimerMeasuresAndCopiesPhases) {
+    StartupTimer timer;
+    EXPECT_EQ(0u,timer.end(StartupTimer::PHASE_COUNT));
+    EXPECT_FALSE(timer.isComplete(StartupTimer::PHASE_NETWORK));
+    timer.begin(StartupTimer::PHASE_NETWORK);
+    ThisThread::sleep_for(20);
+    EXPECT_GE(timer.end(StartupTimer::PHASE_NETWORK),20u);
+    EXPECT_TRUE(timer.isComplete(StartupTimer::PHASE_NETWORK));
+    EXPECT_GE(timer.completedAt(StartupTimer::PHASE_NETWORK),20u);
+    EXPECT_EQ(0u,timer.duration(StartupTimer::PHASE_PLATFORM));
+
+    // copies keep the origin and the phases
+    StartupTimer copy(timer);
+    StartupTimer assigned;
+    assigned = timer;
+    EXPECT_EQ(timer.duration(StartupTimer::PHASE_NETWORK),copy.duration(StartupTimer::PHASE_NETWORK));
+    EXPECT_EQ(timer.completedAt(StartupTimer::PHASE_NETWORK),assigned.completedAt(StartupTimer::PHASE_NETWORK));
+    EXPECT_TRUE(assigned.isComplete(StartupTimer::PHASE_NETWORK));
+    EXPECT_GE(assigned.elapsed(),20u);
+
+    // beginning a phase again discards its completion
+    assigned.begin(StartupTimer::PHASE_NETWORK);
+    EXPECT_FALSE(assigned.isComplete(StartupTimer::PHASE_NETWORK));
+    EXPECT_TRUE(timer.isComplete(StartupTimer::PHASE_NETWORK));
+}
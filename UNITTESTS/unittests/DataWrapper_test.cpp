@@ -0,0 +1,100 @@
+/**
+ * @file    DataWrapper_test.cpp
+ * @brief   Host unit tests for the DataWrapper buffer (reset clears only the used bytes, the rest stays zero)
+ */
+
+#include "gtest/gtest.h"
+#include "mbed-connector-interface/DataWrapper.h"
+
+#include <string.h>
+
+// true when data[from..to) is all zero
+static bool zero(const uint8_t *data,int from,int to) {
+    for (int i = from; i < to; ++i) {
+        if (data[i] != 0) return false;
+    }
+    return true;
+}
+
+TEST(DataWrapper, ExternalBufferIsZeroedOnConstruction) {
+    uint8_t buffer[32];
+    memset(buffer,0xAA,sizeof(buffer));
+    DataWrapper wrapper(buffer,(int)sizeof(buffer));
+    EXPECT_EQ(buffer,wrapper.get());
+    EXPECT_EQ(0,wrapper.length());
+    EXPECT_TRUE(zero(buffer,0,(int)sizeof(buffer)));
+}
+
+TEST(DataWrapper, ShorterWrapLeavesNothingOfTheLongerValue) {
+    uint8_t buffer[32];
+    DataWrapper wrapper(buffer,(int)sizeof(buffer));
+    wrapper.wrap((uint8_t *)"a much longer value",19);
+    ASSERT_EQ(19,wrapper.length());
+
+    wrapper.wrap((uint8_t *)"ab",2);
+    EXPECT_EQ(2,wrapper.length());
+    EXPECT_EQ(0,memcmp("ab",buffer,2));
+    EXPECT_TRUE(zero(buffer,2,(int)sizeof(buffer)));
+}
+
+TEST(DataWrapper, ShorterUnwrapLeavesNothingOfTheLongerValue) {
+    DataWrapper wrapper(32);
+    wrapper.unwrap((uint8_t *)"a much longer value",19);
+    ASSERT_EQ(19,wrapper.length());
+
+    wrapper.unwrap((uint8_t *)"ab",2);
+    EXPECT_EQ(2,wrapper.length());
+    EXPECT_STREQ("ab",(const char *)wrapper.get());
+    EXPECT_TRUE(zero(wrapper.get(),2,32 + 1));
+}
+
+TEST(DataWrapper, ResetClearsTheValue) {
+    DataWrapper wrapper(16);
+    wrapper.wrap((uint8_t *)"0123456789",10);
+    wrapper.reset();
+    EXPECT_EQ(0,wrapper.length());
+    EXPECT_TRUE(zero(wrapper.get(),0,16 + 1));
+
+    // and again with nothing to clear
+    wrapper.reset();
+    EXPECT_EQ(0,wrapper.length());
+}
+
+TEST(DataWrapper, EmptyWrapClearsTheValue) {
+    DataWrapper wrapper(16);
+    wrapper.wrap((uint8_t *)"0123456789",10);
+    wrapper.wrap(NULL,10);
+    EXPECT_EQ(0,wrapper.length());
+    EXPECT_TRUE(zero(wrapper.get(),0,16 + 1));
+
+    wrapper.unwrap((uint8_t *)"0123456789",10);
+    wrapper.unwrap((uint8_t *)"x",0);
+    EXPECT_EQ(0,wrapper.length());
+    EXPECT_TRUE(zero(wrapper.get(),0,16 + 1));
+}
+
+TEST(DataWrapper, ValuesAreTruncatedToTheBuffer) {
+    DataWrapper wrapper(8);
+    wrapper.wrap((uint8_t *)"0123456789AB",12);
+    EXPECT_EQ(8,wrapper.length());
+    EXPECT_STREQ("01234567",(const char *)wrapper.get());
+
+    // a full buffer is cleared completely by the next (shorter) value
+    wrapper.wrap((uint8_t *)"z",1);
+    EXPECT_STREQ("z",(const char *)wrapper.get());
+    EXPECT_TRUE(zero(wrapper.get(),1,8 + 1));
+}
+
+// only the bytes a value used are cleared: the buffer beyond its declared size is never touched
+TEST(DataWrapper, ResetStaysWithinTheUsedBytes) {
+    uint8_t buffer[16];
+    DataWrapper wrapper(buffer,8);
+    memset(buffer + 8,0xEE,8);
+    wrapper.wrap((uint8_t *)"0123456789",10);
+    wrapper.wrap((uint8_t *)"ab",2);
+    wrapper.reset();
+    EXPECT_TRUE(zero(buffer,0,8));
+    for (int i = 8; i < 16; ++i) {
+        EXPECT_EQ(0xEE,buffer[i]) << "byte " << i;
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file    DynamicResourceDecode_test.cpp
+ * @brief   Host unit tests for the typed CoAP payload decoders (coapDataToInteger/coapDataToFloat)
+ */
+
+#include "gtest/gtest.h"
+#include "TestResources.h"
+
+#include <limits.h>
+
+extern Logger logger;
+
+class DecodeTest : public ::testing::Test {
+protected:
+    int integer(const char *text) { return this->m_resource.coapDataToInteger((uint8_t *)text,(int)strlen(text)); }
+    int integer(const uint8_t *data,int length) { return this->m_resource.coapDataToInteger((uint8_t *)data,length); }
+    float real(const char *text) { return this->m_resource.coapDataToFloat((uint8_t *)text,(int)strlen(text)); }
+    float real(const uint8_t *data,int length) { return this->m_resource.coapDataToFloat((uint8_t *)data,length); }
+    void binary() { this->m_resource.setContentFormat(42); }
+
+    CountingResource m_resource { &logger,"3303","5700" };
+};
+
+TEST_F(DecodeTest, TextIntegers) {
+    EXPECT_EQ(0,this->integer("0"));
+    EXPECT_EQ(42,this->integer("42"));
+    EXPECT_EQ(-17,this->integer("-17"));
+    EXPECT_EQ(17,this->integer("+17"));
+    EXPECT_EQ(12,this->integer("12 \r\n"));
+    EXPECT_EQ(99,this->integer((const uint8_t *)"99\0\0",4));
+}
+
+TEST_F(DecodeTest, TextIntegersClampAndTruncate) {
+    EXPECT_EQ(INT_MAX,this->integer("99999999999"));
+    EXPECT_EQ(INT_MIN,this->integer("-99999999999"));
+    EXPECT_EQ(3,this->integer("3.9"));
+    EXPECT_EQ(-3,this->integer("-3.9"));
+}
+
+TEST_F(DecodeTest, FractionalTextIntegersOutOfRangeClamp) {
+    EXPECT_EQ(INT_MAX,this->integer("3000000000.5"));
+    EXPECT_EQ(INT_MIN,this->integer("-3000000000.5"));
+    EXPECT_EQ(INT_MAX,this->integer("1e30"));
+    EXPECT_EQ(INT_MIN,this->integer("-1e30"));
+}
+
+TEST_F(DecodeTest, NonFiniteTextIntegersAreRejected) {
+    EXPECT_EQ(0,this->integer("nan"));
+    EXPECT_EQ(0,this->integer("inf"));
+    EXPECT_EQ(0,this->integer("-inf"));
+    EXPECT_EQ(0,this->integer("1e39"));
+}
+
+TEST_F(DecodeTest, BinaryIntegers) {
+    const uint8_t one[] = { 0xFF };
+    const uint8_t two[] = { 0x01, 0x02 };
+    const uint8_t four[] = { 0xFF, 0xFF, 0xFE, 0x0C };
+    const uint8_t eight[] = { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 };
+    this->binary();
+    EXPECT_EQ(-1,this->integer(one,1));
+    EXPECT_EQ(258,this->integer(two,2));
+    EXPECT_EQ(-500,this->integer(four,4));
+    EXPECT_EQ(INT_MAX,this->integer(eight,8));
+}
+
+TEST_F(DecodeTest, UndecodableIntegersYieldZero) {
+    const uint8_t three[] = { 0x80, 0x81, 0x82 };
+    EXPECT_EQ(0,this->integer("abc"));
+    EXPECT_EQ(0,this->integer(three,3));
+    EXPECT_EQ(0,this->integer((const uint8_t *)NULL,4));
+    EXPECT_EQ(0,this->integer("-x-"));
+    this->binary();
+    EXPECT_EQ(0,this->integer(three,3));
+    EXPECT_EQ(0,this->integer("42 "));
+}
+
+TEST_F(DecodeTest, TextFloats) {
+    EXPECT_FLOAT_EQ(21.5f,this->real("21.5"));
+    EXPECT_FLOAT_EQ(-0.25f,this->real("-0.25"));
+    EXPECT_FLOAT_EQ(1000.0f,this->real("1e3"));
+    EXPECT_FLOAT_EQ(7.0f,this->real("7\r\n"));
+}
+
+TEST_F(DecodeTest, BinaryFloats) {
+    const uint8_t four[] = { 0x3F, 0xC0, 0x00, 0x00 };                              // 1.5f
+    const uint8_t eight[] = { 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };    // 2.25
+    this->binary();
+    EXPECT_FLOAT_EQ(1.5f,this->real(four,4));
+    EXPECT_FLOAT_EQ(2.25f,this->real(eight,8));
+}
+
+TEST_F(DecodeTest, UndecodableFloatsYieldZero) {
+    const uint8_t three[] = { 0x80, 0x81, 0x82 };
+    EXPECT_FLOAT_EQ(0.0f,this->real("x1.0z"));
+    EXPECT_FLOAT_EQ(0.0f,this->real(three,3));
+    std::string huge(200,'1');
+    EXPECT_FLOAT_EQ(0.0f,this->real(huge.c_str()));
+}
+
+TEST_F(DecodeTest, ContentFormatSelectsTheEncoding) {
+    // text content: payloads of binary lengths that are not text are undecodable
+    const uint8_t one_nul[] = { 0x31, 0x00 };
+    const uint8_t four[] = { 0x3F, 0xC0, 0x00, 0x00 };
+    EXPECT_EQ(0,this->integer("-"));
+    EXPECT_EQ(0,this->integer("xx"));
+    EXPECT_EQ(1,this->integer(one_nul,2));
+    EXPECT_FLOAT_EQ(0.0f,this->real(four,4));
+
+    // binary content: text payloads are decoded as big-endian integers/IEEE754 floats
+    this->binary();
+    EXPECT_EQ(0x3100,this->integer(one_nul,2));
+    EXPECT_EQ(0x2D,this->integer("-"));
+    EXPECT_EQ(0x31323334,this->integer("1234"));
+    EXPECT_FLOAT_EQ(1.5f,this->real(four,4));
+    EXPECT_FLOAT_EQ(0.0f,this->real("21.50"));
+}
+
+TEST_F(DecodeTest, DataWrapperIsUnwrappedFirst) {
+    DataWrapper wrapper(32);
+    this->m_resource.setDataWrapper(&wrapper);
+    EXPECT_EQ(314,this->integer("314"));
+    EXPECT_FLOAT_EQ(3.25f,this->real("3.25"));
+    this->m_resource.setDataWrapper(NULL);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file    DynamicResourceIndex_test.cpp
+ * @brief   Host unit tests for the M2MBase to DynamicResource dispatch index
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/DynamicResourceIndex.h"
+
+#include <vector>
+
+extern Logger logger;
+
+class DynamicResourceIndexTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        for (int i = 0; i < 40; ++i) {
+            this->m_resources.push_back(new CountingResource(&logger,"3303",indexed_name("",5000 + i).c_str()));
+            this->m_host.add(this->m_resources.back());
+        }
+        this->m_endpoint = this->m_host.build();
+        for (size_t i = 0; i < this->m_resources.size(); ++i) {
+            this->m_list.push_back(this->m_resources[i]);
+        }
+    }
+    virtual void TearDown() {
+        for (size_t i = 0; i < this->m_resources.size(); ++i) delete this->m_resources[i];
+    }
+
+    HostEndpoint                     m_host { &logger };
+    Connector::Endpoint             *m_endpoint;
+    std::vector<CountingResource *>  m_resources;
+    std::vector<DynamicResource *>   m_list;
+};
+
+TEST_F(DynamicResourceIndexTest, LooksUpEveryBoundResource) {
+    DynamicResourceIndex index;
+    EXPECT_FALSE(index.isBuilt());
+    index.build(&this->m_list);
+    EXPECT_TRUE(index.isBuilt());
+    EXPECT_EQ(40,index.size());
+    for (size_t i = 0; i < this->m_resources.size(); ++i) {
+        EXPECT_EQ(this->m_resources[i],index.lookup(this->m_resources[i]->getResource()));
+    }
+    M2MResource other("other");
+    EXPECT_EQ(NULL,index.lookup(&other));
+    EXPECT_EQ(NULL,index.lookup(NULL));
+}
+
+TEST_F(DynamicResourceIndexTest, CopyIsDeep) {
+    DynamicResourceIndex *index = new DynamicResourceIndex();
+    index->build(&this->m_list);
+    DynamicResourceIndex copy(*index);
+    delete index;
+    EXPECT_EQ(40,copy.size());
+    EXPECT_EQ(this->m_resources[7],copy.lookup(this->m_resources[7]->getResource()));
+}
+
+TEST_F(DynamicResourceIndexTest, AssignmentIsDeep) {
+    DynamicResourceIndex *index = new DynamicResourceIndex();
+    index->build(&this->m_list);
+    DynamicResourceIndex assigned;
+    std::vector<DynamicResource *> one(1,this->m_resources[0]);
+    assigned.build(&one);
+    assigned = *index;
+    delete index;
+    EXPECT_EQ(40,assigned.size());
+    EXPECT_EQ(this->m_resources[39],assigned.lookup(this->m_resources[39]->getResource()));
+    assigned = assigned;
+    EXPECT_EQ(this->m_resources[39],assigned.lookup(this->m_resources[39]->getResource()));
+}
+
+TEST_F(DynamicResourceIndexTest, EndpointCopyOwnsItsIndex) {
+    {
+        Connector::Endpoint copy(*this->m_endpoint);
+    }
+    M2MResource *res = (M2MResource *)this->m_resources[3]->getResource();
+    res->set_value((const uint8_t *)"1",1);
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    this->m_endpoint->value_updated(res,M2MBase::Resource);
+    EXPECT_EQ(1,this->m_resources[3]->m_puts.load());
+}
+
+TEST_F(DynamicResourceIndexTest, ResourcesBoundAfterTheIndexAreStillDispatched) {
+    CountingResource late(&logger,"3303","5999");
+    this->m_host.add(&late);
+    late.bind(this->m_endpoint);
+    M2MResource *res = (M2MResource *)late.getResource();
+    ASSERT_NE((void *)NULL,(void *)res);
+    res->set_value((const uint8_t *)"1",1);
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    this->m_endpoint->value_updated(res,M2MBase::Resource);
+    EXPECT_EQ(1,late.m_puts.load());
+}
+
+TEST_F(DynamicResourceIndexTest, AddGrowsTheIndex) {
+    DynamicResourceIndex index;
+    for (size_t i = 0; i < this->m_resources.size(); ++i) {
+        EXPECT_TRUE(index.add(this->m_resources[i]));
+    }
+    EXPECT_EQ(40,index.size());
+    for (size_t i = 0; i < this->m_resources.size(); ++i) {
+        EXPECT_EQ(this->m_resources[i],index.lookup(this->m_resources[i]->getResource()));
+    }
+
+    // adding again replaces (no duplicate entry), unbound resources are not indexed
+    EXPECT_TRUE(index.add(this->m_resources[0]));
+    EXPECT_EQ(40,index.size());
+    CountingResource unbound(&logger,"3303","5998");
+    EXPECT_FALSE(index.add(&unbound));
+    EXPECT_FALSE(index.add(NULL));
+    EXPECT_EQ(40,index.size());
+}
+
+TEST_F(DynamicResourceIndexTest, RebuildingTheEndpointIndexesTheNewBindings) {
+    M2MResource *before = (M2MResource *)this->m_resources[11]->getResource();
+    this->m_endpoint->buildEndpoint();
+    M2MResource *after = (M2MResource *)this->m_resources[11]->getResource();
+    ASSERT_NE((void *)NULL,(void *)after);
+    ASSERT_NE((void *)before,(void *)after);
+    after->set_value((const uint8_t *)"1",1);
+    after->set_operation(M2MBase::PUT_ALLOWED);
+    this->m_endpoint->value_updated(after,M2MBase::Resource);
+    EXPECT_EQ(1,this->m_resources[11]->m_puts.load());
+
+    // the earlier binding is no longer ours
+    before->set_operation(M2MBase::PUT_ALLOWED);
+    this->m_endpoint->value_updated(before,M2MBase::Resource);
+    EXPECT_EQ(1,this->m_resources[11]->m_puts.load());
+}
+
+TEST_F(DynamicResourceIndexTest, ResourcesIndexedByAnotherEndpointAreNotOurs) {
+    // in our resource list, but bound to (and indexed by) another endpoint
+    HostEndpoint other(&logger);
+    other.build();
+    CountingResource foreign(&logger,"3303","5997");
+    this->m_host.add(&foreign);
+    foreign.bind(other.endpoint());
+    M2MResource *res = (M2MResource *)foreign.getResource();
+    ASSERT_NE((void *)NULL,(void *)res);
+    res->set_value((const uint8_t *)"1",1);
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    this->m_endpoint->value_updated(res,M2MBase::Resource);
+    EXPECT_EQ(0,foreign.m_puts.load());
+    other.endpoint()->value_updated(res,M2MBase::Resource);
+    EXPECT_EQ(1,foreign.m_puts.load());
+}
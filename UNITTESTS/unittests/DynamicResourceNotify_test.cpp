@@ -0,0 +1,92 @@
+/**
+ * @file    DynamicResourceNotify_test.cpp
+ * @brief   Host unit tests for the DynamicResource notify path and DataWrapper
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "AllocationCounter.h"
+
+extern Logger logger;
+
+class DynamicResourceNotifyTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        this->m_host.add(&this->m_resource).build();
+        this->m_res = (M2MResource *)this->m_resource.getResource();
+    }
+    std::string value() { return this->m_res->valueString(); }
+
+    HostEndpoint      m_host { &logger };
+    CountingResource  m_resource { &logger,"3303","5700" };
+    M2MResource      *m_res;
+};
+
+TEST_F(DynamicResourceNotifyTest, BytesAreWrittenVerbatim) {
+    const uint8_t payload[] = { 'a', 0x00, 'b', 0xFF };
+    EXPECT_EQ(0,this->m_resource.notify(payload,(int)sizeof(payload)));
+    EXPECT_EQ(std::string((const char *)payload,sizeof(payload)),this->value());
+}
+
+TEST_F(DynamicResourceNotifyTest, OverloadsAreEquivalent) {
+    this->m_resource.notify(std::string("12.5"));
+    EXPECT_EQ(std::string("12.5"),this->value());
+    this->m_resource.notify("13.5",4);
+    EXPECT_EQ(std::string("13.5"),this->value());
+    this->m_resource.notify((const uint8_t *)"14.5",4);
+    EXPECT_EQ(std::string("14.5"),this->value());
+}
+
+TEST_F(DynamicResourceNotifyTest, LongValuesAreNotTruncated) {
+    std::string payload(1000,'x');
+    payload[999] = 'y';
+    this->m_resource.notify(payload);
+    EXPECT_EQ(payload,this->value());
+}
+
+TEST_F(DynamicResourceNotifyTest, DataWrapperIsUsedWhenSet) {
+    DataWrapper wrapper(64);
+    this->m_resource.setDataWrapper(&wrapper);
+    this->m_resource.notify(std::string("wrapped"));
+    EXPECT_EQ(std::string("wrapped"),this->value());
+    this->m_resource.setDataWrapper(NULL);
+}
+
+// notify() writes straight into the resource value (or wraps in place): no heap allocation per notification
+TEST_F(DynamicResourceNotifyTest, NotifyDoesNotAllocate) {
+    uint8_t payload[256];
+    memset(payload,'v',sizeof(payload));
+    const std::string value(256,'s');
+    this->m_host.registered();
+
+    // the first notification of a given size may size the resource value
+    this->m_resource.notify(payload,(int)sizeof(payload));
+    AllocationCounter counter;
+    for (int i = 0; i < 16; ++i) {
+        payload[0] = (uint8_t)('a' + i);
+        this->m_resource.notify(payload,(int)sizeof(payload));
+        this->m_resource.notify(value);
+        this->m_resource.notify((const char *)payload,(int)sizeof(payload));
+    }
+    EXPECT_EQ(0u,counter.allocations());
+    EXPECT_EQ(std::string((const char *)payload,sizeof(payload)),this->value());
+}
+
+TEST_F(DynamicResourceNotifyTest, WrappedNotifyDoesNotAllocate) {
+    DataWrapper wrapper(512);
+    uint8_t payload[256];
+    memset(payload,'w',sizeof(payload));
+    this->m_resource.setDataWrapper(&wrapper);
+    this->m_host.registered();
+
+    this->m_resource.notify(payload,(int)sizeof(payload));
+    AllocationCounter counter;
+    for (int i = 0; i < 16; ++i) {
+        payload[0] = (uint8_t)('a' + i);
+        this->m_resource.notify(payload,(int)sizeof(payload));
+    }
+    EXPECT_EQ(0u,counter.allocations());
+    EXPECT_EQ(std::string((const char *)payload,sizeof(payload)),this->value());
+    this->m_resource.setDataWrapper(NULL);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file    DynamicResourceProcess_test.cpp
+ * @brief   Host unit tests for DynamicResource::process() operation dispatch
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+class DynamicResourceProcessTest : public ::testing::Test {
+protected:
+    DynamicResourceProcessTest() : m_pc(USBTX,USBRX), m_logger(&m_pc), m_host(&m_logger), m_resource(&m_logger,"3311","5850") {}
+    virtual void SetUp() {
+        this->m_host.add(&this->m_resource).build();
+        this->m_res = (M2MResource *)this->m_resource.getResource();
+        this->m_res->set_value((const uint8_t *)"on",2);
+        this->m_pc.capture(true);
+    }
+
+    Serial            m_pc;
+    Logger            m_logger;
+    HostEndpoint      m_host;
+    CountingResource  m_resource;
+    M2MResource      *m_res;
+};
+
+TEST_F(DynamicResourceProcessTest, PutIsDispatchedOnce) {
+    EXPECT_EQ(0,this->m_resource.process(M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(1,this->m_resource.m_puts.load());
+    EXPECT_EQ(std::string("on"),this->m_resource.m_last_put);
+    EXPECT_EQ(0,this->m_resource.m_posts.load());
+    EXPECT_EQ(0,this->m_resource.m_deletes.load());
+}
+
+TEST_F(DynamicResourceProcessTest, PostIsDispatchedOnce) {
+    EXPECT_EQ(0,this->m_resource.process(M2MBase::POST_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(1,this->m_resource.m_posts.load());
+    EXPECT_EQ(0,this->m_resource.m_deletes.load());
+}
+
+TEST_F(DynamicResourceProcessTest, DeleteIsDispatchedOnceAndSucceeds) {
+    EXPECT_EQ(0,this->m_resource.process(M2MBase::DELETE_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(1,this->m_resource.m_deletes.load());
+    EXPECT_EQ(std::string::npos,this->m_pc.output().find("Unknown Operation"));
+}
+
+TEST_F(DynamicResourceProcessTest, PayloadOverloadUsesTheGivenPayload) {
+    uint8_t payload[] = { 'o', 'f', 'f' };
+    EXPECT_EQ(0,this->m_resource.process(M2MBase::PUT_ALLOWED,M2MBase::Resource,payload,3));
+    EXPECT_EQ(std::string("off"),this->m_resource.m_last_put);
+}
+
+TEST_F(DynamicResourceProcessTest, UnknownOperationFailsAndNamesTheResource) {
+    EXPECT_EQ(1,this->m_resource.process(M2MBase::GET_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(0,this->m_resource.m_puts.load() + this->m_resource.m_posts.load() + this->m_resource.m_deletes.load());
+    EXPECT_EQ(std::string("CountingResource: Unknown Operation (0x1) for [3311/0/5850]=[on]... FAILED.\r\n"),this->m_pc.output());
+}
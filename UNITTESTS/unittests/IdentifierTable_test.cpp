@@ -0,0 +1,88 @@
+/**
+ * @file    IdentifierTable_test.cpp
+ * @brief   Host unit tests for the shared object/resource identifier table
+ */
+
+#include "gtest/gtest.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/IdentifierTable.h"
+
+#include <set>
+#include <vector>
+
+extern Logger logger;
+
+TEST(IdentifierTableTest, InstanceIsShared) {
+    EXPECT_EQ(IdentifierTable::instance(),IdentifierTable::instance());
+}
+
+// first use from several threads at once (each test runs in its own process, so the table is created here)
+struct InstanceProbe {
+    IdentifierTable *seen = NULL;
+    void run() { this->seen = IdentifierTable::instance(); }
+};
+
+TEST(IdentifierTableTest, InstanceIsSharedAcrossThreads) {
+    InstanceProbe probes[4];
+    Thread threads[4];
+    for (int i = 0; i < 4; ++i) {
+        threads[i].start(callback(&probes[i],&InstanceProbe::run));
+    }
+    for (int i = 0; i < 4; ++i) {
+        threads[i].join();
+        EXPECT_EQ(IdentifierTable::instance(),probes[i].seen);
+    }
+}
+
+TEST(IdentifierTableTest, NumericIdentifiersAreNotInterned) {
+    IdentifierTable *table = IdentifierTable::instance();
+    EXPECT_EQ((IdentifierHandle)3303,table->intern("3303"));
+    EXPECT_TRUE(IdentifierTable::isNumeric(table->intern("5700")));
+    EXPECT_FALSE(IdentifierTable::isNumeric(table->intern("05700")));
+    EXPECT_EQ(IDENTIFIER_INVALID,table->intern(NULL));
+}
+
+TEST(IdentifierTableTest, InternIsStableAcrossGrowth) {
+    IdentifierTable *table = IdentifierTable::instance();
+    std::vector<IdentifierHandle> handles;
+    std::set<IdentifierHandle> unique;
+    for (int i = 0; i < 500; ++i) {
+        handles.push_back(table->intern(indexed_name("ident_stable_",i).c_str()));
+        unique.insert(handles.back());
+    }
+    EXPECT_EQ((size_t)500,unique.size());
+    for (int i = 0; i < 500; ++i) {
+        std::string name = indexed_name("ident_stable_",i);
+        EXPECT_EQ(handles[i],table->intern(name.c_str()));
+        EXPECT_STREQ(name.c_str(),table->str(handles[i]));
+    }
+}
+
+TEST(IdentifierTableTest, NameReturnsTheSharedString) {
+    IdentifierTable *table = IdentifierTable::instance();
+    IdentifierHandle handle = table->intern("ident_shared");
+    const string &first = table->name(handle);
+    const string &second = table->name(handle);
+    EXPECT_EQ("ident_shared",first);
+    EXPECT_EQ(&first,&second);
+    EXPECT_EQ(table->str(handle),first.c_str());
+}
+
+TEST(IdentifierTableTest, NameRendersNumericIdentifiersOnce) {
+    IdentifierTable *table = IdentifierTable::instance();
+    const string &first = table->name(table->intern("3304"));
+    int size = table->size();
+    const string &second = table->name((IdentifierHandle)3304);
+    EXPECT_EQ("3304",first);
+    EXPECT_EQ(&first,&second);
+    EXPECT_EQ(size,table->size());
+    EXPECT_TRUE(IdentifierTable::isNumeric(table->intern("3304")));
+    EXPECT_EQ("",table->name(IDENTIFIER_INVALID));
+}
+
+TEST(IdentifierTableTest, ResourceNamesAreReferences) {
+    CountingResource resource(&logger,"3303","ident_res");
+    EXPECT_EQ("3303",resource.getObjName());
+    EXPECT_EQ("ident_res",resource.getResName());
+    EXPECT_EQ(&resource.getResName(),&resource.getResName());
+}
@@ -0,0 +1,178 @@
+/**
+ * @file    InboundDispatcher_test.cpp
+ * @brief   Host unit tests for the asynchronous inbound request dispatcher
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/InboundDispatcher.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern Logger logger;
+
+// PUT blocks until released and records every value it is given
+class GatedResource : public CountingResource {
+public:
+    GatedResource(const Logger *logger) : CountingResource(logger,"3311","5850"), m_open(false) {}
+    virtual void put(const string value) {
+        std::unique_lock<std::mutex> lock(this->m_lock);
+        this->m_values.push_back(value);
+        this->m_changed.notify_all();
+        this->m_changed.wait(lock,[this] { return this->m_open; });
+    }
+    void open() {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        this->m_open = true;
+        this->m_changed.notify_all();
+    }
+    bool waitForValues(size_t count) {
+        std::unique_lock<std::mutex> lock(this->m_lock);
+        return this->m_changed.wait_for(lock,std::chrono::seconds(5),[this,count] { return this->m_values.size() >= count; });
+    }
+    std::vector<std::string> values() {
+        std::lock_guard<std::mutex> lock(this->m_lock);
+        return this->m_values;
+    }
+
+    std::mutex               m_lock;
+    std::condition_variable  m_changed;
+    bool                     m_open;
+    std::vector<std::string> m_values;
+};
+
+static void set_request(M2MResource *res,const char *value) {
+    res->set_value((const uint8_t *)value,(uint32_t)strlen(value));
+}
+
+class InboundDispatcherTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        this->m_host.add(&this->m_resource).build();
+        this->m_res = (M2MResource *)this->m_resource.getResource();
+    }
+
+    HostEndpoint   m_host { &logger };
+    GatedResource  m_resource { &logger };
+    M2MResource   *m_res;
+};
+
+TEST_F(InboundDispatcherTest, QueuedPutUsesThePayloadItWasQueuedWith) {
+    InboundDispatcher dispatcher(&logger,4,InboundDispatcher::DROP_NEWEST);
+    ASSERT_TRUE(dispatcher.start());
+    set_request(this->m_res,"first");
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    ASSERT_TRUE(this->m_resource.waitForValues(1));
+    set_request(this->m_res,"second");
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    set_request(this->m_res,"third");
+    this->m_resource.open();
+    ASSERT_TRUE(this->m_resource.waitForValues(2));
+    dispatcher.halt();
+    std::vector<std::string> values = this->m_resource.values();
+    ASSERT_EQ(2u,values.size());
+    EXPECT_EQ(std::string("first"),values[0]);
+    EXPECT_EQ(std::string("second"),values[1]);
+}
+
+TEST_F(InboundDispatcherTest, DropNewestRejectsWhenFull) {
+    InboundDispatcher dispatcher(&logger,1,InboundDispatcher::DROP_NEWEST);
+    ASSERT_TRUE(dispatcher.start());
+    set_request(this->m_res,"busy");
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    ASSERT_TRUE(this->m_resource.waitForValues(1));
+    EXPECT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    EXPECT_FALSE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(1u,dispatcher.getStatistics(InboundDispatcher::OPERATION_PUT).dropped);
+    this->m_resource.open();
+    dispatcher.halt();
+}
+
+TEST_F(InboundDispatcherTest, HaltWaitsForTheWorkerAndDiscardsTheQueue) {
+    InboundDispatcher dispatcher(&logger,4,InboundDispatcher::DROP_NEWEST);
+    ASSERT_TRUE(dispatcher.start());
+    set_request(this->m_res,"busy");
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    ASSERT_TRUE(this->m_resource.waitForValues(1));
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    ASSERT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    std::thread opener([this] { ThisThread::sleep_for(50); this->m_resource.open(); });
+    dispatcher.halt();
+    opener.join();
+    EXPECT_EQ(0,dispatcher.getPending());
+    EXPECT_GE(this->m_resource.values().size(),1u);
+
+    // once halted, requests are processed inline
+    size_t before = this->m_resource.values().size();
+    set_request(this->m_res,"inline");
+    EXPECT_TRUE(dispatcher.dispatch(&this->m_resource,M2MBase::PUT_ALLOWED,M2MBase::Resource));
+    EXPECT_EQ(before + 1,this->m_resource.values().size());
+}
+
+TEST(InboundDispatcherEndpoint, EndpointCopyHasItsOwnDispatcher) {
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3311","5850");
+    host.builder().setInboundDispatcher(4,InboundDispatcher::DROP_NEWEST);
+    host.add(&resource);
+    Connector::Endpoint *ep = host.build();
+    ASSERT_NE((void *)NULL,(void *)ep->getInboundDispatcher());
+    Connector::Endpoint *copy = new Connector::Endpoint(*ep);
+    ASSERT_NE((void *)NULL,(void *)copy->getInboundDispatcher());
+    EXPECT_NE(ep->getInboundDispatcher(),copy->getInboundDispatcher());
+    delete copy;
+
+    // the original still dispatches
+    M2MResource *res = (M2MResource *)resource.getResource();
+    set_request(res,"on");
+    res->set_operation(M2MBase::PUT_ALLOWED);
+    ep->value_updated(res,M2MBase::Resource);
+    for (int i = 0; i < 500 && resource.m_puts.load() == 0; ++i) ThisThread::sleep_for(1);
+    EXPECT_EQ(1,resource.m_puts.load());
+}
+
+// PUT only counts (safe to process from several threads at once)
+class TallyResource : public CountingResource {
+public:
+    TallyResource(const Logger *logger) : CountingResource(logger,"3311","5851") {}
+    virtual void put(const string /* value */) { ++this->m_puts; }
+};
+
+TEST(InboundDispatcherHalt, RequestsRacingHaltAreProcessedOrDropped) {
+    HostEndpoint host(&logger);
+    TallyResource resource(&logger);
+    host.add(&resource).build();
+    set_request((M2MResource *)resource.getResource(),"1");
+
+    // every request dispatched while halting is either processed (queued or inline) or dropped, never stranded in the queue
+    for (int round = 0; round < 200; ++round) {
+        InboundDispatcher dispatcher(&logger,64,InboundDispatcher::DROP_NEWEST);
+        ASSERT_TRUE(dispatcher.start());
+        std::atomic<bool> go(false);
+        std::atomic<int> accepted(0);
+        std::vector<std::thread> callers;
+        for (int i = 0; i < 4; ++i) {
+            callers.push_back(std::thread([&]() {
+                while (go.load() == false) {
+                }
+                for (int j = 0; j < 16; ++j) {
+                    if (dispatcher.dispatch(&resource,M2MBase::PUT_ALLOWED,M2MBase::Resource) == true) {
+                        ++accepted;
+                    }
+                }
+            }));
+        }
+        go = true;
+        dispatcher.halt();
+        for (size_t i = 0; i < callers.size(); ++i) {
+            callers[i].join();
+        }
+        InboundDispatcher::Statistics stats = dispatcher.getStatistics(InboundDispatcher::OPERATION_PUT);
+        ASSERT_EQ(0,dispatcher.getPending()) << "round " << round;
+        ASSERT_EQ((uint32_t)accepted.load(),stats.processed + stats.dropped) << "round " << round;
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file    LazyBind_test.cpp
+ * @brief   Host unit tests for lazily bound DynamicResource values and the endpoint's background resolver
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+// a slow sensor: get() blocks until the test opens the gate (a synchronous get() in bind() would hang the test)
+class SlowSensor : public CountingResource {
+public:
+    SlowSensor(const Logger *logger) : CountingResource(logger,"3303","5700"), m_gate(0) {
+        this->setLazyBind(true);
+    }
+    virtual string get() {
+        this->m_gate.wait();
+        this->m_gate.release();
+        ThisThread::sleep_for(5);
+        return CountingResource::get();
+    }
+    void open() { this->m_gate.release(); }
+    using DynamicResource::observeValue;
+
+    Semaphore m_gate;
+};
+
+// calls resolvePendingValue() from its own thread
+struct Resolver {
+    DynamicResource *resource;
+    void run() { this->resource->resolvePendingValue(); }
+};
+
+TEST(LazyBindTest, BindDoesNotCallGet) {
+    SlowSensor sensor(&logger);
+    {
+        HostEndpoint host(&logger);
+        host.add(&sensor);
+        host.build();
+        EXPECT_EQ(0,(int)sensor.m_gets);
+        sensor.open();
+    }
+
+    // destroying the endpoint waited for the background resolver
+    EXPECT_EQ(1,(int)sensor.m_gets);
+    EXPECT_FALSE(sensor.isValuePending());
+}
+
+TEST(LazyBindTest, PlaceholderIsResolvedOnce) {
+    SlowSensor sensor(&logger);
+    HostEndpoint host(&logger);
+    host.add(&sensor);
+    host.build();
+
+    Resolver resolvers[4];
+    Thread threads[4];
+    for (int i = 0; i < 4; ++i) {
+        resolvers[i].resource = &sensor;
+        threads[i].start(callback(&resolvers[i],&Resolver::run));
+    }
+    sensor.open();
+    for (int i = 0; i < 4; ++i) {
+        threads[i].join();
+    }
+
+    // deregistration waits for the background resolver too
+    host.unregistered();
+    EXPECT_EQ(1,(int)sensor.m_gets);
+}
+
+TEST(LazyBindTest, ObservationClaimsThePlaceholder) {
+    SlowSensor sensor(&logger);
+    HostEndpoint host(&logger);
+    host.add(&sensor);
+    host.build();
+
+    // the observed value replaces the placeholder (unless the resolver already claimed it)... nothing is left to resolve
+    sensor.observeValue((const uint8_t *)"21",2);
+    EXPECT_FALSE(sensor.isValuePending());
+    sensor.resolvePendingValue();
+    EXPECT_EQ(0,(int)sensor.m_gets);
+    sensor.open();
+}
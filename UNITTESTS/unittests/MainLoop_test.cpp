@@ -0,0 +1,146 @@
+/**
+ * @file    MainLoop_test.cpp
+ * @brief   Host unit tests for the event driven endpoint main loop and its work ring (net_post_work())
+ */
+
+#include "gtest/gtest.h"
+#include "mbed-connector-interface/ConnectorEndpoint.h"
+#include "mbed-connector-interface/mbedEndpointNetworkImpl.h"
+#include "mbed-connector-interface/ConnectionManager.h"
+#include "mbed-connector-interface/RamNotificationStore.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+#include <atomic>
+#include <vector>
+
+extern Logger logger;
+
+// main loop internals (mbedEndpointNetwork.cpp)
+extern "C" void configure_main_loop_params(Connector::Endpoint *endpoint);
+extern "C" bool run_main_loop_once(uint32_t timeout_ms);
+
+static std::vector<int> s_ran;
+static osThreadId_t s_ran_on = NULL;
+
+static void record(void *arg) {
+    s_ran.push_back((int)(intptr_t)arg);
+    s_ran_on = ThisThread::get_id();
+}
+
+class MainLoopTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        // drain anything an earlier test left pending
+        configure_main_loop_params(NULL);
+        run_main_loop_once(0);
+        s_ran.clear();
+        s_ran_on = NULL;
+    }
+};
+
+TEST_F(MainLoopTest, PostedWorkRunsInOrderOnTheMainLoop) {
+    EXPECT_TRUE(net_post_work(record,(void *)1));
+    EXPECT_TRUE(net_post_work(record,(void *)2));
+    EXPECT_TRUE(net_post_work(record,(void *)3));
+    EXPECT_TRUE(s_ran.empty());
+    EXPECT_TRUE(run_main_loop_once(1000));
+    ASSERT_EQ(3u,s_ran.size());
+    EXPECT_EQ(1,s_ran[0]);
+    EXPECT_EQ(2,s_ran[1]);
+    EXPECT_EQ(3,s_ran[2]);
+    EXPECT_EQ(ThisThread::get_id(),s_ran_on);
+}
+
+TEST_F(MainLoopTest, FullRingRejectsWorkUntilDrained) {
+    for (int i = 0; i < MAIN_LOOP_WORK_QUEUE_DEPTH; ++i) {
+        EXPECT_TRUE(net_post_work(record,(void *)(intptr_t)i));
+    }
+    EXPECT_FALSE(net_post_work(record,(void *)99));
+    EXPECT_TRUE(run_main_loop_once(1000));
+    ASSERT_EQ((size_t)MAIN_LOOP_WORK_QUEUE_DEPTH,s_ran.size());
+    for (int i = 0; i < MAIN_LOOP_WORK_QUEUE_DEPTH; ++i) {
+        EXPECT_EQ(i,s_ran[i]);
+    }
+
+    // the ring wraps once drained
+    s_ran.clear();
+    EXPECT_TRUE(net_post_work(record,(void *)100));
+    EXPECT_TRUE(run_main_loop_once(1000));
+    ASSERT_EQ(1u,s_ran.size());
+    EXPECT_EQ(100,s_ran[0]);
+}
+
+TEST_F(MainLoopTest, NullWorkIsRejected) {
+    EXPECT_FALSE(net_post_work(NULL,NULL));
+}
+
+TEST_F(MainLoopTest, SleepsUntilAnEvent) {
+    uint64_t start = Kernel::get_ms_count();
+    EXPECT_TRUE(run_main_loop_once(50));
+    EXPECT_GE(Kernel::get_ms_count() - start,45u);
+    EXPECT_TRUE(s_ran.empty());
+}
+
+TEST_F(MainLoopTest, RegistrationChangesWakeTheLoop) {
+    net_registration_changed();
+    uint64_t start = Kernel::get_ms_count();
+    EXPECT_TRUE(run_main_loop_once(5000));
+    EXPECT_LT(Kernel::get_ms_count() - start,2000u);
+}
+
+// work posted from interrupt context wakes a waiting main loop
+struct IsrPoster {
+    std::atomic<bool> posted { false };
+    void fire() { this->posted = net_post_work(record,(void *)7); }
+};
+
+TEST_F(MainLoopTest, WorkPostedFromAnIsrWakesTheLoop) {
+    IsrPoster poster;
+    Timeout timeout;
+    timeout.attach_us(callback(&poster,&IsrPoster::fire),20000);
+    uint64_t start = Kernel::get_ms_count();
+    EXPECT_TRUE(run_main_loop_once(5000));
+    EXPECT_LT(Kernel::get_ms_count() - start,2000u);
+    EXPECT_TRUE(poster.posted.load());
+    ASSERT_EQ(1u,s_ran.size());
+    EXPECT_EQ(7,s_ran[0]);
+}
+
+TEST_F(MainLoopTest, ShutdownEndsTheLoop) {
+    net_shutdown_endpoint();
+    EXPECT_FALSE(run_main_loop_once(1000));
+    configure_main_loop_params(NULL);
+    EXPECT_TRUE(run_main_loop_once(0));
+}
+
+TEST_F(MainLoopTest, UnrequestedDeregistrationReRegistersAfterABackoff) {
+    RamNotificationStore store(1024);
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5700");
+    host.builder().setNotificationStore(&store);
+    host.add(&resource).build();
+    ASSERT_TRUE(host.endpoint()->getEndpointInterface() != NULL);
+    ((ConnectionManager *)net_get_connection_manager())->registrationSucceeded();
+    net_plumb_network(host.endpoint());
+    host.registered();
+    EXPECT_TRUE(run_main_loop_once(0));
+
+    // the server dropped us: nothing is re-registered until the backoff elapses
+    host.unregistered();
+    EXPECT_TRUE(run_main_loop_once(1000));
+    EXPECT_EQ(0,host.endpoint()->getEndpointInterface()->setup_calls);
+    uint64_t start = Kernel::get_ms_count();
+    EXPECT_TRUE(run_main_loop_once(5000));
+    EXPECT_EQ(1,host.endpoint()->getEndpointInterface()->setup_calls);
+    uint32_t min_ms = CONNECTION_BACKOFF_INITIAL_MS - (CONNECTION_BACKOFF_INITIAL_MS * CONNECTION_BACKOFF_JITTER_PERCENT) / 100;
+    EXPECT_GE(Kernel::get_ms_count() - start + 50,(uint64_t)min_ms);
+
+    // later attempts back off further
+    EXPECT_GT(((ConnectionManager *)net_get_connection_manager())->nextRegistrationDelay(),(uint32_t)CONNECTION_BACKOFF_INITIAL_MS);
+
+    // forget the endpoint (and any pending re-registration)
+    configure_main_loop_params(NULL);
+    net_plumb_network(NULL);
+    ((ConnectionManager *)net_get_connection_manager())->registrationSucceeded();
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    NamedPointer_test.cpp
+ * @brief   Host unit tests for NamedPointer copy/move semantics and the ObjectInstanceManager object list
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "AllocationCounter.h"
+#include "mbed-connector-interface/NamedPointer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+extern Logger logger;
+
+static NamedPointer with_children(IdentifierHandle id,int children) {
+    NamedPointer np(id,NULL,0);
+    for (int i = 0; i < children; ++i) {
+        ((NamedPointerList *)np.list())->push_back(NamedPointer((IdentifierHandle)i,NULL,i));
+    }
+    return np;
+}
+
+TEST(NamedPointerTest, ListIsCreatedOnFirstUse) {
+    NamedPointer np((IdentifierHandle)3303,NULL,0);
+    EXPECT_EQ(0,np.listSize());
+    NamedPointer copy(np);
+    EXPECT_EQ(0,copy.listSize());
+    EXPECT_TRUE(np.list() != NULL);
+    EXPECT_EQ(0,np.listSize());
+}
+
+TEST(NamedPointerTest, CopiesOwnTheirList) {
+    NamedPointer np = with_children(3303,3);
+    NamedPointer copy(np);
+    NamedPointer assigned = with_children(3304,1);
+    assigned = np;
+    EXPECT_NE(np.list(),copy.list());
+    EXPECT_NE(np.list(),assigned.list());
+    ((NamedPointerList *)np.list())->clear();
+    EXPECT_EQ(3,copy.listSize());
+    EXPECT_EQ(3,assigned.listSize());
+    EXPECT_EQ((IdentifierHandle)3303,assigned.id());
+    assigned = assigned;
+    EXPECT_EQ(3,assigned.listSize());
+}
+
+TEST(NamedPointerTest, MovesHandOverTheList) {
+    NamedPointer np = with_children(3303,2);
+    void *list = np.list();
+    NamedPointer moved(std::move(np));
+    EXPECT_EQ(list,moved.list());
+    EXPECT_EQ(0,np.listSize());
+
+    NamedPointer assigned = with_children(3304,5);
+    assigned = std::move(moved);
+    EXPECT_EQ(list,assigned.list());
+    EXPECT_EQ(2,assigned.listSize());
+    EXPECT_EQ(0,moved.listSize());
+}
+
+TEST(NamedPointerTest, GrowingAListKeepsChildLists) {
+    NamedPointerList list;
+    for (int i = 0; i < 64; ++i) {
+        list.push_back(with_children((IdentifierHandle)(1000 + i),i % 4));
+    }
+    for (int i = 0; i < 64; ++i) {
+        EXPECT_EQ(i % 4,list[i].listSize());
+    }
+}
+
+TEST(NamedPointerTest, ObjectListIsNotCopied) {
+    HostEndpoint host(&logger);
+    ObjectInstanceManager manager(&logger,(void *)host.endpoint());
+    manager.createDynamicResourceInstance((IdentifierHandle)3303,(IdentifierHandle)5700,"Temperature",M2MResourceInstance::FLOAT,true);
+    manager.createDynamicResourceInstance((IdentifierHandle)3304,(IdentifierHandle)5700,"Humidity",M2MResourceInstance::FLOAT,true);
+    const NamedPointerList &first = manager.getObjectList();
+    const NamedPointerList &second = manager.getObjectList();
+    EXPECT_EQ(&first,&second);
+    EXPECT_EQ(2,(int)first.size());
+    EXPECT_EQ("3303",((NamedPointer &)first[0]).name());
+    EXPECT_EQ(1,((NamedPointer &)first[0]).listSize());
+}
+
+TEST(NamedPointerTest, GettingTheObjectListDoesNotAllocate) {
+    HostEndpoint host(&logger);
+    ObjectInstanceManager manager(&logger,(void *)host.endpoint());
+    for (int i = 0; i < 32; ++i) {
+        manager.createDynamicResourceInstance((IdentifierHandle)(3300 + (i % 4)),(IdentifierHandle)(5700 + i),"Sensor",M2MResourceInstance::FLOAT,true);
+    }
+    AllocationCounter counter;
+    const NamedPointerList &list = manager.getObjectList();
+    int instances = 0;
+    for (size_t i = 0; i < list.size(); ++i) {
+        instances += ((NamedPointer &)list[i]).listSize();
+    }
+    EXPECT_EQ(0u,counter.allocations());
+    EXPECT_EQ(4,(int)list.size());
+    EXPECT_EQ(4,instances);
+}
+
+// allocations made by Endpoint::buildEndpoint() for an endpoint of count resources (four per object)
+static uint64_t build_allocations(int count) {
+    std::vector<std::string> objects;
+    std::vector<std::string> names;
+    std::vector< std::unique_ptr<CountingResource> > resources;
+    HostEndpoint host(&logger);
+    for (int i = 0; i < count; ++i) {
+        objects.push_back(std::to_string(10000 + (i / 4)));
+        names.push_back(std::to_string(5000 + (i % 4)));
+    }
+    for (int i = 0; i < count; ++i) {
+        resources.emplace_back(new CountingResource(&logger,objects[i].c_str(),names[i].c_str()));
+        host.add(resources.back().get());
+    }
+    host.endpoint()->setOptions(host.builder().build());
+    AllocationCounter counter;
+    host.endpoint()->buildEndpoint();
+    return counter.allocations();
+}
+
+TEST(NamedPointerTest, BuildEndpointAllocationsGrowLinearly) {
+    // copies of the object tree (per object or per build pass) would make the cost of each resource grow with the tree
+    uint64_t small = build_allocations(32);
+    uint64_t medium = build_allocations(64);
+    uint64_t large = build_allocations(128);
+    ASSERT_GT(medium,small);
+    ASSERT_GT(large,medium);
+    uint64_t per_32 = (medium - small);
+    uint64_t per_64 = (large - medium);
+    EXPECT_LE(per_64,(2 * per_32) + 8) << "32: " << small << " 64: " << medium << " 128: " << large;
+}
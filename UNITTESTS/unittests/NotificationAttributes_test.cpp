@@ -0,0 +1,85 @@
+/**
+ * @file    NotificationAttributes_test.cpp
+ * @brief   Host unit tests for the client side LwM2M notification attributes (pmin/pmax/gt/lt/st)
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+class NotificationAttributesTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        this->m_host.add(&this->m_resource).build();
+        this->m_host.registered();
+    }
+    uint32_t sample(const char *value) {
+        this->m_resource.setCurrent(value);
+        this->m_resource.observe();
+        return this->m_resource.getEmittedNotificationCount();
+    }
+
+    HostEndpoint      m_host { &logger };
+    CountingResource  m_resource { &logger,"3303","5700" };
+};
+
+TEST_F(NotificationAttributesTest, StepGovernsNotifications) {
+    this->m_resource.setStep(1.0);
+    EXPECT_EQ(1u,this->sample("10.0"));
+    EXPECT_EQ(1u,this->sample("10.5"));
+    EXPECT_EQ(2u,this->sample("11.2"));
+    EXPECT_EQ(2u,this->sample("11.0"));
+}
+
+TEST_F(NotificationAttributesTest, ThresholdCrossingsNotify) {
+    this->m_resource.setGreaterThan(20.0);
+    this->m_resource.setLessThan(5.0);
+    EXPECT_EQ(1u,this->sample("10"));
+    EXPECT_EQ(1u,this->sample("15"));
+    EXPECT_EQ(2u,this->sample("21"));
+    EXPECT_EQ(3u,this->sample("4"));
+}
+
+TEST_F(NotificationAttributesTest, PminHoldsNotificationsBack) {
+    this->m_resource.setMinimumPeriod(1000);
+    EXPECT_EQ(1u,this->sample("1"));
+    EXPECT_EQ(1u,this->sample("2"));
+    EXPECT_EQ(1u,this->sample("3"));
+}
+
+TEST_F(NotificationAttributesTest, ChangeHeldByPminIsSentOncePminElapses) {
+    this->m_resource.setMinimumPeriod(50);
+    this->m_resource.setGreaterThan(20.0);
+    EXPECT_EQ(1u,this->sample("10"));
+
+    // crosses the threshold within pmin... and is back below it by the time pmin has elapsed
+    EXPECT_EQ(1u,this->sample("25"));
+    ThisThread::sleep_for(60);
+    EXPECT_EQ(2u,this->sample("10"));
+
+    // the pending change has been delivered
+    ThisThread::sleep_for(60);
+    EXPECT_EQ(2u,this->sample("10"));
+}
+
+TEST_F(NotificationAttributesTest, PmaxForcesANotification) {
+    this->m_resource.setMaximumPeriod(50);
+    this->m_resource.setStep(100.0);
+    EXPECT_EQ(1u,this->sample("1"));
+    EXPECT_EQ(1u,this->sample("2"));
+    ThisThread::sleep_for(60);
+    EXPECT_EQ(2u,this->sample("3"));
+}
+
+TEST_F(NotificationAttributesTest, ClearingAttributesDropsThePendingChange) {
+    this->m_resource.setMinimumPeriod(50);
+    this->m_resource.setGreaterThan(20.0);
+    EXPECT_EQ(1u,this->sample("10"));
+    EXPECT_EQ(1u,this->sample("25"));
+    this->m_resource.clearNotificationAttributes();
+    this->m_resource.setGreaterThan(20.0);
+    EXPECT_EQ(2u,this->sample("10"));
+    EXPECT_EQ(2u,this->sample("11"));
+}
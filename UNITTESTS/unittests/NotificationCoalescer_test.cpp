@@ -0,0 +1,107 @@
+/**
+ * @file    NotificationCoalescer_test.cpp
+ * @brief   Host unit tests for the endpoint notification coalescing window
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/NotificationCoalescer.h"
+
+#include <atomic>
+
+extern Logger logger;
+
+// runs an action from timer (ISR) context and waits for it
+struct IsrAction {
+    std::atomic<bool> done { false };
+    virtual ~IsrAction() {}
+    virtual void action() = 0;
+    void fire() { this->action(); this->done = true; }
+    void run() {
+        Timeout timeout;
+        timeout.attach(callback(this,&IsrAction::fire),0.001f);
+        while (this->done == false) ThisThread::sleep_for(1);
+    }
+};
+
+class NotificationCoalescerTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        this->m_host.add(&this->m_first).add(&this->m_second).build();
+    }
+    std::string value(DynamicResource &resource) { return ((M2MResource *)resource.getResource())->valueString(); }
+
+    HostEndpoint      m_host { &logger };
+    CountingResource  m_first { &logger,"3303","5700" };
+    CountingResource  m_second { &logger,"3303","5701" };
+};
+
+TEST_F(NotificationCoalescerTest, HeldUntilFlushed) {
+    NotificationCoalescer coalescer(&logger,1000);
+    this->m_first.notify(std::string("0"));
+    EXPECT_TRUE(coalescer.submit(&this->m_first,(const uint8_t *)"1",1));
+    EXPECT_TRUE(coalescer.submit(&this->m_second,(const uint8_t *)"2",1));
+    EXPECT_EQ("0",this->value(this->m_first));
+    coalescer.flush();
+    EXPECT_EQ("1",this->value(this->m_first));
+    EXPECT_EQ("2",this->value(this->m_second));
+    NotificationCoalescer::Statistics stats = coalescer.getStatistics();
+    EXPECT_EQ(2U,stats.submitted);
+    EXPECT_EQ(1U,stats.batches);
+    EXPECT_EQ(2U,stats.max_batch);
+}
+
+TEST_F(NotificationCoalescerTest, LatestValueWins) {
+    NotificationCoalescer coalescer(&logger,1000);
+    coalescer.submit(&this->m_first,(const uint8_t *)"1",1);
+    coalescer.submit(&this->m_first,(const uint8_t *)"22",2);
+    coalescer.flush();
+    EXPECT_EQ("22",this->value(this->m_first));
+    EXPECT_EQ(1U,coalescer.getStatistics().superseded);
+    EXPECT_EQ(1U,coalescer.getStatistics().flushed);
+}
+
+TEST_F(NotificationCoalescerTest, FullWindowIsNotHeld) {
+    NotificationCoalescer coalescer(&logger,1000,1);
+    EXPECT_TRUE(coalescer.submit(&this->m_first,(const uint8_t *)"1",1));
+    EXPECT_FALSE(coalescer.submit(&this->m_second,(const uint8_t *)"2",1));
+    EXPECT_EQ(1U,coalescer.getStatistics().overflowed);
+    coalescer.flush();
+}
+
+TEST_F(NotificationCoalescerTest, IsrSubmitIsNotHeld) {
+    NotificationCoalescer coalescer(&logger,1000);
+    struct Submit : IsrAction {
+        NotificationCoalescer *coalescer; DynamicResource *resource; bool held = true;
+        void action() { this->held = this->coalescer->submit(this->resource,(const uint8_t *)"1",1); }
+    } submit;
+    submit.coalescer = &coalescer;
+    submit.resource = &this->m_first;
+    submit.run();
+    EXPECT_FALSE(submit.held);
+    EXPECT_EQ(0U,coalescer.getStatistics().submitted);
+}
+
+TEST(NotificationCoalescerEndpointTest, IsrNotifyIsSentDirectly) {
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5700");
+    host.builder().setNotificationCoalescing(1000);
+    host.add(&resource).build();
+    host.registered();
+    ASSERT_TRUE(host.endpoint()->getNotificationCoalescer() != NULL);
+
+    // thread context: held for the window
+    resource.notify(std::string("held"));
+    EXPECT_NE("held",((M2MResource *)resource.getResource())->valueString());
+
+    // ISR context: written at once
+    struct Notify : IsrAction {
+        DynamicResource *resource;
+        void action() { this->resource->notify((const uint8_t *)"isr",3); }
+    } notify;
+    notify.resource = &resource;
+    notify.run();
+    EXPECT_EQ("isr",((M2MResource *)resource.getResource())->valueString());
+    host.endpoint()->getNotificationCoalescer()->flush();
+}
@@ -0,0 +1,263 @@
+/**
+ * @file    NotificationStore_test.cpp
+ * @brief   Host unit tests for the notification store backends and store-and-forward across outages
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/FileNotificationStore.h"
+#include "mbed-connector-interface/RamNotificationStore.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+extern Logger logger;
+
+// wait (bounded) for a condition set by another thread
+template <typename F> static bool eventually(F condition,uint32_t timeout_ms = 5000) {
+    uint64_t deadline = Kernel::get_ms_count() + timeout_ms;
+    while (condition() == false) {
+        if (Kernel::get_ms_count() >= deadline) {
+            return false;
+        }
+        ThisThread::sleep_for(1);
+    }
+    return true;
+}
+
+// a store file of our own (removed afterwards)
+class FileNotificationStoreTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        snprintf(this->m_path,sizeof(this->m_path),"/tmp/connector_store_%d.dat",(int)getpid());
+        remove(this->m_path);
+    }
+    virtual void TearDown() {
+        remove(this->m_path);
+    }
+    char m_path[64];
+};
+
+TEST_F(FileNotificationStoreTest, RecordsRoundTrip) {
+    FileNotificationStore store(this->m_path,1024);
+    ASSERT_TRUE(store.open());
+    EXPECT_TRUE(store.push("3303/0/5700",1234,(const uint8_t *)"21.5",4));
+    EXPECT_TRUE(store.push("3303/0/5701",1235,(const uint8_t *)"Cel",3));
+    EXPECT_EQ(2,store.count());
+
+    char name[NOTIFICATION_STORE_NAME_LENGTH+1];
+    uint8_t data[16];
+    uint64_t timestamp_ms = 0;
+    EXPECT_EQ(4,store.shift(name,sizeof(name),timestamp_ms,data,sizeof(data)));
+    EXPECT_STREQ("3303/0/5700",name);
+    EXPECT_EQ(1234U,timestamp_ms);
+    EXPECT_EQ(0,memcmp(data,"21.5",4));
+    EXPECT_EQ(3,store.shift(name,sizeof(name),timestamp_ms,data,sizeof(data)));
+    EXPECT_STREQ("3303/0/5701",name);
+    EXPECT_EQ(-1,store.shift(name,sizeof(name),timestamp_ms,data,sizeof(data)));
+}
+
+TEST_F(FileNotificationStoreTest, RecordsSurviveReopen) {
+    {
+        FileNotificationStore store(this->m_path,1024);
+        ASSERT_TRUE(store.open());
+        store.push("3303/0/5700",1,(const uint8_t *)"1",1);
+        store.push("3303/0/5700",2,(const uint8_t *)"2",1);
+    }
+    FileNotificationStore store(this->m_path,1024);
+    ASSERT_TRUE(store.open());
+    EXPECT_EQ(2,store.count());
+    char name[NOTIFICATION_STORE_NAME_LENGTH+1];
+    uint8_t data[4];
+    uint64_t timestamp_ms = 0;
+    EXPECT_EQ(1,store.shift(name,sizeof(name),timestamp_ms,data,sizeof(data)));
+    EXPECT_EQ(1U,timestamp_ms);
+    EXPECT_EQ('1',data[0]);
+}
+
+TEST_F(FileNotificationStoreTest, DifferentCapacityStartsEmpty) {
+    {
+        FileNotificationStore store(this->m_path,1024);
+        ASSERT_TRUE(store.open());
+        store.push("3303/0/5700",1,(const uint8_t *)"1",1);
+    }
+    FileNotificationStore store(this->m_path,2048);
+    ASSERT_TRUE(store.open());
+    EXPECT_EQ(0,store.count());
+}
+
+TEST_F(FileNotificationStoreTest, FullStoreDropsOldest) {
+    FileNotificationStore store(this->m_path,256);
+    ASSERT_TRUE(store.open());
+    uint8_t payload[32];
+    memset(payload,'x',sizeof(payload));
+    for (int i = 0; i < 20; ++i) {
+        payload[0] = (uint8_t)('a' + i);
+        EXPECT_TRUE(store.push("3303/0/5700",(uint64_t)i,payload,(int)sizeof(payload)));
+    }
+    EXPECT_GT(store.dropped(),0U);
+    EXPECT_EQ(20,store.count() + (int)store.dropped());
+
+    // the newest records are kept, in order
+    char name[NOTIFICATION_STORE_NAME_LENGTH+1];
+    uint8_t data[32];
+    uint64_t timestamp_ms = 0;
+    uint64_t expected = store.dropped();
+    while (store.shift(name,sizeof(name),timestamp_ms,data,sizeof(data)) >= 0) {
+        EXPECT_EQ(expected,timestamp_ms);
+        EXPECT_EQ((uint8_t)('a' + expected),data[0]);
+        ++expected;
+    }
+    EXPECT_EQ(20U,expected);
+}
+
+TEST_F(FileNotificationStoreTest, OversizedRecordIsRejected) {
+    FileNotificationStore store(this->m_path,64);
+    ASSERT_TRUE(store.open());
+    uint8_t payload[128];
+    memset(payload,'x',sizeof(payload));
+    EXPECT_FALSE(store.push("3303/0/5700",1,payload,(int)sizeof(payload)));
+    EXPECT_EQ(0,store.count());
+}
+
+// an endpoint with a RAM store
+class StoreAndForwardTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        this->m_host.builder().setNotificationStore(&this->m_store);
+        this->m_host.add(&this->m_resource).build();
+        this->m_res = (M2MResource *)this->m_resource.getResource();
+        this->m_host.registered();
+    }
+    std::string value() { return this->m_res->valueString(); }
+
+    RamNotificationStore m_store { 4096 };
+    HostEndpoint         m_host { &logger };
+    CountingResource     m_resource { &logger,"3303","5700" };
+    M2MResource         *m_res;
+};
+
+TEST_F(StoreAndForwardTest, OnlineNotificationsAreDelivered) {
+    this->m_resource.notify(std::string("20"));
+    EXPECT_EQ(0,this->m_store.count());
+    EXPECT_EQ("20",this->value());
+}
+
+TEST_F(StoreAndForwardTest, LinkLossRecordsAndReconnectReplays) {
+    this->m_resource.notify(std::string("20"));
+    this->m_host.endpoint()->isConnected(false);
+    EXPECT_TRUE(this->m_host.endpoint()->isRegistered());
+    this->m_resource.notify(std::string("21"));
+    this->m_resource.notify(std::string("22"));
+    EXPECT_EQ(2,this->m_store.count());
+    EXPECT_EQ("20",this->value());
+
+    this->m_host.endpoint()->isConnected(true);
+    EXPECT_TRUE(eventually([&]() { return this->m_store.count() == 0; }));
+    EXPECT_TRUE(eventually([&]() { return this->value() == "22"; }));
+}
+
+TEST_F(StoreAndForwardTest, DeregistrationKeepsRecording) {
+    this->m_host.unregistered();
+    EXPECT_FALSE(this->m_host.endpoint()->isRegistered());
+    EXPECT_TRUE(this->m_host.endpoint()->isConnected());
+    EXPECT_TRUE(this->m_resource.canObserve());
+    this->m_resource.notify(std::string("23"));
+    EXPECT_EQ(1,this->m_store.count());
+
+    this->m_host.registered();
+    EXPECT_TRUE(eventually([&]() { return this->m_store.count() == 0; }));
+    EXPECT_TRUE(eventually([&]() { return this->value() == "23"; }));
+}
+
+TEST_F(StoreAndForwardTest, RequestedDeregistrationStopsRecording) {
+    this->m_host.endpoint()->de_register_endpoint();
+    this->m_host.unregistered();
+    EXPECT_FALSE(this->m_host.endpoint()->isConnected());
+}
+
+TEST_F(StoreAndForwardTest, BacklogDrainsInBatches) {
+    this->m_host.unregistered();
+    for (int i = 0; i < 64; ++i) {
+        this->m_resource.notify(indexed_name("",i));
+    }
+    EXPECT_EQ(64,this->m_store.count());
+
+    // one interval per batch, not per notification
+    uint64_t start = Kernel::get_ms_count();
+    this->m_host.registered();
+    EXPECT_TRUE(eventually([&]() { return this->m_store.count() == 0 && this->m_host.endpoint()->isReplaying() == false; }));
+    EXPECT_LT(Kernel::get_ms_count() - start,(uint64_t)(64 * NOTIFICATION_REPLAY_INTERVAL_MS) / 4);
+    EXPECT_EQ("63",this->value());
+}
+
+TEST_F(StoreAndForwardTest, LiveNotificationsQueueBehindReplay) {
+    this->m_host.unregistered();
+    for (int i = 0; i < 40; ++i) {
+        this->m_resource.notify(indexed_name("",i));
+    }
+    this->m_host.registered();
+    this->m_resource.notify(std::string("live"));
+    EXPECT_TRUE(eventually([&]() { return this->m_store.count() == 0 && this->m_host.endpoint()->isReplaying() == false; }));
+    EXPECT_EQ("live",this->value());
+
+    // caught up: straight out again
+    this->m_resource.notify(std::string("next"));
+    EXPECT_EQ(0,this->m_store.count());
+    EXPECT_EQ("next",this->value());
+}
+
+TEST(StoreAndForward, ConcurrentReplayRequestsStartOneReplayThread) {
+    // registration callbacks and notify() (observer threads) may all ask for the first replay at once
+    for (int round = 0; round < 50; ++round) {
+        RamNotificationStore store(1024);
+        HostEndpoint host(&logger);
+        CountingResource resource(&logger,"3303","5700");
+        host.builder().setNotificationStore(&store);
+        host.add(&resource).build();
+        host.registered();
+
+        // recorded while offline (the replay thread is not started until a replay is asked for)
+        ASSERT_TRUE(store.push("3303/0/5700",1,(const uint8_t *)"42",2));
+        std::atomic<int> ready(0);
+        std::atomic<bool> go(false);
+        std::vector<std::thread> callers;
+        int started = Thread::started().load();
+        for (int i = 0; i < 8; ++i) {
+            callers.push_back(std::thread([&]() {
+                ++ready;
+                while (go.load() == false) {
+                }
+                host.endpoint()->replayNotifications();
+            }));
+        }
+        while (ready.load() < 8) {
+            std::this_thread::yield();
+        }
+        go = true;
+        for (size_t i = 0; i < callers.size(); ++i) {
+            callers[i].join();
+        }
+        ASSERT_EQ(started + 1,Thread::started().load()) << "round " << round;
+        EXPECT_TRUE(eventually([&]() { return store.count() == 0; }));
+    }
+}
+
+TEST_F(StoreAndForwardTest, IsrNotifyIsNotStored) {
+    this->m_host.unregistered();
+    struct Notify {
+        DynamicResource   *resource;
+        std::atomic<bool>  done { false };
+        void fire() { this->resource->notify((const uint8_t *)"isr",3); this->done = true; }
+    } notify;
+    notify.resource = &this->m_resource;
+    Timeout timeout;
+    timeout.attach(callback(&notify,&Notify::fire),0.001f);
+    EXPECT_TRUE(eventually([&]() { return notify.done == true; }));
+    EXPECT_EQ(0,this->m_store.count());
+    EXPECT_TRUE(this->m_store.push("3303/0/5700",1,(const uint8_t *)"1",1));
+}
@@ -0,0 +1,66 @@
+/**
+ * @file    ObjectInstanceIndex_test.cpp
+ * @brief   Host unit tests for the ObjectInstanceManager (Object ID, Resource ID) index
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/ObjectInstanceIndex.h"
+
+#include <vector>
+
+extern Logger logger;
+
+TEST(ObjectInstanceIndexTest, StoresAndReplacesValues) {
+    ObjectInstanceIndex index;
+    EXPECT_EQ(-1,index.lookup(3303,IDENTIFIER_INVALID));
+    EXPECT_TRUE(index.set(3303,IDENTIFIER_INVALID,0));
+    EXPECT_TRUE(index.set(3303,5700,1));
+    EXPECT_TRUE(index.set(3303,5700,2));
+    EXPECT_EQ(0,index.lookup(3303,IDENTIFIER_INVALID));
+    EXPECT_EQ(2,index.lookup(3303,5700));
+    EXPECT_EQ(-1,index.lookup(3304,5700));
+    EXPECT_EQ(2,index.size());
+    EXPECT_FALSE(index.set(IDENTIFIER_INVALID,5700,1));
+}
+
+TEST(ObjectInstanceIndexTest, GrowsPastInitialCapacity) {
+    ObjectInstanceIndex index;
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(index.set(1000 + (i % 16),5000 + i,i));
+    }
+    EXPECT_EQ(1000,index.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i,index.lookup(1000 + (i % 16),5000 + i));
+    }
+}
+
+TEST(ObjectInstanceIndexTest, CopiesAreIndependent) {
+    ObjectInstanceIndex index;
+    index.set(3303,5700,1);
+    ObjectInstanceIndex copy(index);
+    ObjectInstanceIndex assigned;
+    assigned.set(3304,5700,7);
+    assigned = index;
+    index.set(3303,5700,9);
+    index.clear();
+    EXPECT_EQ(1,copy.lookup(3303,5700));
+    EXPECT_EQ(1,assigned.lookup(3303,5700));
+    EXPECT_EQ(-1,assigned.lookup(3304,5700));
+    EXPECT_EQ(1,assigned.size());
+    assigned = assigned;
+    EXPECT_EQ(1,assigned.lookup(3303,5700));
+}
+
+TEST(ObjectInstanceIndexTest, ManagerCopyOwnsItsIndex) {
+    HostEndpoint host(&logger);
+    ObjectInstanceManager manager(&logger,(void *)host.endpoint());
+    EXPECT_TRUE(manager.createDynamicResourceInstance((IdentifierHandle)3303,(IdentifierHandle)5700,"Temperature",M2MResourceInstance::FLOAT,true) != NULL);
+    ObjectInstanceManager *copy = new ObjectInstanceManager(manager);
+    delete copy;
+
+    // the original's index survives the copy being destroyed
+    EXPECT_TRUE(manager.createDynamicResourceInstance((IdentifierHandle)3303,(IdentifierHandle)5701,"Units",M2MResourceInstance::STRING,false) != NULL);
+    EXPECT_EQ(1,(int)manager.getObjectList().size());
+}
@@ -0,0 +1,144 @@
+/**
+ * @file    ObservationHistogram_test.cpp
+ * @brief   Host unit tests for the log-linear ObservationHistogram (bucketing, percentiles, saturation)
+ */
+
+#include "gtest/gtest.h"
+#include "mbed-connector-interface/ObservationHistogram.h"
+
+#include <string.h>
+
+TEST(ObservationHistogram, SmallValuesHaveExactBuckets) {
+    for (uint32_t value = 0; value < (uint32_t)OBSERVATION_HISTOGRAM_SUB_BUCKETS; ++value) {
+        EXPECT_EQ((int)value,ObservationHistogram::bucketOf(value));
+        EXPECT_EQ(value,ObservationHistogram::bucketUpperBound((int)value));
+    }
+}
+
+TEST(ObservationHistogram, BucketsHoldTheirValuesWithBoundedError) {
+    int previous = 0;
+    for (uint32_t value = 1; value < (1U << OBSERVATION_HISTOGRAM_RANGE_BITS); value += (value >> 6) + 1) {
+        int bucket = ObservationHistogram::bucketOf(value);
+        ASSERT_GE(bucket,previous) << "value " << value;
+        ASSERT_LT(bucket,OBSERVATION_HISTOGRAM_BUCKETS - 1) << "value " << value;
+
+        // the value lies in (upper bound of the previous bucket, upper bound of its own bucket]
+        uint32_t upper = ObservationHistogram::bucketUpperBound(bucket);
+        ASSERT_GE(upper,value) << "value " << value;
+        ASSERT_LT(ObservationHistogram::bucketUpperBound(bucket - 1),value) << "value " << value;
+
+        // each bucket is at most 1/OBSERVATION_HISTOGRAM_SUB_BUCKETS of its lower bound wide
+        ASSERT_LE((uint64_t)upper - value,(uint64_t)value / OBSERVATION_HISTOGRAM_SUB_BUCKETS) << "value " << value;
+        previous = bucket;
+    }
+}
+
+TEST(ObservationHistogram, OutOfRangeValuesShareTheLastBucket) {
+    uint32_t largest = (1U << OBSERVATION_HISTOGRAM_RANGE_BITS) - 1;
+    EXPECT_EQ(OBSERVATION_HISTOGRAM_BUCKETS - 2,ObservationHistogram::bucketOf(largest));
+    EXPECT_EQ(largest,ObservationHistogram::bucketUpperBound(OBSERVATION_HISTOGRAM_BUCKETS - 2));
+    EXPECT_EQ(OBSERVATION_HISTOGRAM_BUCKETS - 1,ObservationHistogram::bucketOf(largest + 1));
+    EXPECT_EQ(OBSERVATION_HISTOGRAM_BUCKETS - 1,ObservationHistogram::bucketOf(0xFFFFFFFFU));
+    EXPECT_EQ(0xFFFFFFFFU,ObservationHistogram::bucketUpperBound(OBSERVATION_HISTOGRAM_BUCKETS - 1));
+}
+
+TEST(ObservationHistogram, EmptyHistogram) {
+    ObservationHistogram histogram;
+    EXPECT_EQ(0u,histogram.count());
+    EXPECT_EQ(0u,histogram.min());
+    EXPECT_EQ(0u,histogram.max());
+    EXPECT_EQ(0u,histogram.mean());
+    EXPECT_EQ(0u,histogram.percentile(50));
+    EXPECT_EQ(0u,histogram.percentile(100));
+}
+
+TEST(ObservationHistogram, PercentilesAreBucketUpperBounds) {
+    ObservationHistogram histogram;
+    for (uint32_t value = 1; value <= 100; ++value) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(100u,histogram.count());
+    EXPECT_EQ(1u,histogram.min());
+    EXPECT_EQ(100u,histogram.max());
+    EXPECT_EQ(50u,histogram.mean());
+
+    // never below the true percentile: the upper bound of its bucket
+    const int percents[] = { 1, 10, 50, 90 };
+    for (size_t i = 0; i < sizeof(percents)/sizeof(percents[0]); ++i) {
+        uint32_t exact = (uint32_t)percents[i];
+        EXPECT_GE(histogram.percentile(percents[i]),exact) << "p" << percents[i];
+        EXPECT_EQ(ObservationHistogram::bucketUpperBound(ObservationHistogram::bucketOf(exact)),histogram.percentile(percents[i])) << "p" << percents[i];
+    }
+
+    // the top percentiles are clamped to the largest sample (their bucket reaches 111)
+    EXPECT_EQ(100u,histogram.percentile(99));
+    EXPECT_EQ(100u,histogram.percentile(100));
+    EXPECT_EQ(100u,histogram.percentile(150));
+    EXPECT_EQ(1u,histogram.percentile(0));
+    EXPECT_EQ(1u,histogram.percentile(-5));
+}
+
+TEST(ObservationHistogram, SmallSamplesGiveExactPercentiles) {
+    ObservationHistogram histogram;
+    histogram.record(1);
+    histogram.record(2);
+    histogram.record(3);
+    EXPECT_EQ(1u,histogram.percentile(33));
+    EXPECT_EQ(2u,histogram.percentile(50));
+    EXPECT_EQ(3u,histogram.percentile(90));
+}
+
+TEST(ObservationHistogram, SaturatingABucketHalvesThemAll) {
+    ObservationHistogram histogram;
+    histogram.record(100);
+    histogram.record(200);
+    histogram.record(200);
+    for (int i = 0; i < 0xFFFF; ++i) {
+        histogram.record(7);
+    }
+    EXPECT_EQ(200u,histogram.percentile(100));
+
+    // the next sample would overflow the bucket of 7: the single 100 ages out, the two 200s become one
+    histogram.record(7);
+    EXPECT_EQ(0x10000u + 3,histogram.count());
+    EXPECT_EQ(200u,histogram.max());
+    EXPECT_EQ(200u,histogram.percentile(100));
+    EXPECT_EQ(7u,histogram.percentile(99));
+
+    // only the 200 bucket remains above 7 (0x8000 sevens, one 200)
+    ObservationHistogram expected;
+    expected.record(200);
+    for (int i = 0; i < 0x8000; ++i) {
+        expected.record(7);
+    }
+    for (int percent = 0; percent <= 100; ++percent) {
+        EXPECT_EQ(expected.percentile(percent),histogram.percentile(percent)) << "p" << percent;
+    }
+}
+
+TEST(ObservationHistogram, ResetDiscardsAllSamples) {
+    ObservationHistogram histogram;
+    histogram.record(5);
+    histogram.record(5000);
+    histogram.reset();
+    EXPECT_EQ(0u,histogram.count());
+    EXPECT_EQ(0u,histogram.max());
+    EXPECT_EQ(0u,histogram.percentile(100));
+    histogram.record(9);
+    EXPECT_EQ(9u,histogram.min());
+    EXPECT_EQ(9u,histogram.percentile(50));
+}
+
+TEST(ObservationHistogram, FormatsASummary) {
+    ObservationHistogram histogram;
+    histogram.record(1);
+    histogram.record(2);
+    histogram.record(3);
+    char buffer[64];
+    EXPECT_EQ((int)strlen("n:3 p50:2 p90:3 p99:3 max:3"),histogram.format(buffer,sizeof(buffer)));
+    EXPECT_STREQ("n:3 p50:2 p90:3 p99:3 max:3",buffer);
+
+    // truncated to the buffer
+    EXPECT_EQ(7,histogram.format(buffer,8));
+    EXPECT_STREQ("n:3 p50",buffer);
+}
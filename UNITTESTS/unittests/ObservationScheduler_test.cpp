@@ -0,0 +1,132 @@
+/**
+ * @file    ObservationScheduler_test.cpp
+ * @brief   Host unit tests for the shared observation scheduler
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/ObservationScheduler.h"
+#include "mbed-connector-interface/ScheduledResourceObserver.h"
+
+#include <atomic>
+
+extern Logger logger;
+
+// first use from several threads at once (each test runs in its own process, so the scheduler is created here)
+struct SchedulerProbe {
+    ObservationScheduler *seen = NULL;
+    void run() { this->seen = ObservationScheduler::instance(); }
+};
+
+TEST(ObservationSchedulerInstance, InstanceIsSharedAcrossThreads) {
+    SchedulerProbe probes[4];
+    Thread threads[4];
+    for (int i = 0; i < 4; ++i) {
+        threads[i].start(callback(&probes[i],&SchedulerProbe::run));
+    }
+    for (int i = 0; i < 4; ++i) {
+        threads[i].join();
+        EXPECT_EQ(ObservationScheduler::instance(),probes[i].seen);
+    }
+}
+
+// GET takes a while (so that observations are in flight when the observer is removed)
+class SlowResource : public CountingResource {
+public:
+    SlowResource(const Logger *logger,const char *res_name,int get_ms) : CountingResource(logger,"3303",res_name), m_get_ms(get_ms), m_in_get(false), m_completed(0) {}
+    virtual string get() {
+        this->m_in_get = true;
+        ThisThread::sleep_for(this->m_get_ms);
+        string value = CountingResource::get();
+        ++this->m_completed;
+        this->m_in_get = false;
+        return value;
+    }
+    int               m_get_ms;
+    std::atomic<bool> m_in_get;
+    std::atomic<int>  m_completed;
+};
+
+static bool wait_for(std::atomic<bool> &flag,int timeout_ms) {
+    for (int i = 0; i < timeout_ms && flag.load() == false; ++i) ThisThread::sleep_for(1);
+    return flag.load();
+}
+
+TEST(ObservationScheduler, ObservesEachPeriod) {
+    HostEndpoint host(&logger);
+    SlowResource resource(&logger,"5700",0);
+    host.add(&resource).build();
+    host.registered();
+    ScheduledResourceObserver *observer = new ScheduledResourceObserver(&resource,10);
+    observer->beginObservation();
+    ThisThread::sleep_for(120);
+    delete observer;
+    int gets = resource.m_gets.load();
+    EXPECT_GE(gets,5);
+    EXPECT_LE(gets,14);
+    ThisThread::sleep_for(30);
+    EXPECT_EQ(gets,resource.m_gets.load());
+}
+
+TEST(ObservationScheduler, RemoveWaitsForTheObservationInFlight) {
+    HostEndpoint host(&logger);
+    SlowResource resource(&logger,"5701",80);
+    host.add(&resource).build();
+    host.registered();
+    ScheduledResourceObserver *observer = new ScheduledResourceObserver(&resource,5);
+    observer->beginObservation();
+    ASSERT_TRUE(wait_for(resource.m_in_get,1000));
+
+    // remove() (via the destructor) must not return while get() is still running
+    delete observer;
+    EXPECT_FALSE(resource.m_in_get.load());
+    EXPECT_EQ(resource.m_gets.load(),resource.m_completed.load());
+    int completed = resource.m_completed.load();
+    ThisThread::sleep_for(30);
+    EXPECT_EQ(completed,resource.m_completed.load());
+    EXPECT_EQ(0,ObservationScheduler::instance()->size());
+}
+
+TEST(ObservationScheduler, StopAndRestartWhileInFlight) {
+    HostEndpoint host(&logger);
+    SlowResource resource(&logger,"5702",30);
+    host.add(&resource).build();
+    host.registered();
+    ScheduledResourceObserver observer(&resource,5);
+    observer.beginObservation();
+    ASSERT_TRUE(wait_for(resource.m_in_get,1000));
+    observer.stopObservation();
+    observer.beginObservation();
+    int completed = resource.m_completed.load();
+    ThisThread::sleep_for(100);
+    EXPECT_GT(resource.m_completed.load(),completed);
+    observer.stopObservation();
+}
+
+TEST(ObservationScheduler, NearbyDeadlinesShareATick) {
+    HostEndpoint host(&logger);
+    SlowResource a(&logger,"5703",0);
+    SlowResource b(&logger,"5704",0);
+    SlowResource c(&logger,"5705",0);
+    host.add(&a).add(&b).add(&c).build();
+    host.registered();
+
+    // distinct periods (no phase offsets) whose deadlines differ by a few ms
+    ObservationScheduler::instance()->resetStatistics();
+    ScheduledResourceObserver *oa = new ScheduledResourceObserver(&a,100);
+    ScheduledResourceObserver *ob = new ScheduledResourceObserver(&b,101);
+    ScheduledResourceObserver *oc = new ScheduledResourceObserver(&c,102);
+    oa->beginObservation();
+    ob->beginObservation();
+    oc->beginObservation();
+    ThisThread::sleep_for(150);
+    delete oa;
+    delete ob;
+    delete oc;
+
+    ObservationScheduler::Statistics stats = ObservationScheduler::instance()->getStatistics();
+    EXPECT_EQ(3u,stats.observations);
+    EXPECT_EQ(1u,stats.ticks);
+    EXPECT_EQ(3u,stats.peak_per_tick);
+}
@@ -0,0 +1,152 @@
+/**
+ * @file    ResourceObserverMechanisms_test.cpp
+ * @brief   Host unit tests for the threaded, ticker and EventQueue ResourceObserver scheduling
+ */
+
+#include "gtest/gtest.h"
+
+// the device builds one of these (mbedConnectorInterface.h)... their sources are built with their macro on the host.
+// Only the observer headers test the macros, so they are declared here and nowhere else.
+#define CONNECTOR_USING_THREADS         1
+#define CONNECTOR_USING_TICKER          1
+#define CONNECTOR_USING_EVENT_QUEUES    1
+#include "mbed-connector-interface/ThreadedResourceObserver.h"
+#include "mbed-connector-interface/TickerResourceObserver.h"
+#include "mbed-connector-interface/EventQueueResourceObserver.h"
+#undef CONNECTOR_USING_THREADS
+#undef CONNECTOR_USING_TICKER
+#undef CONNECTOR_USING_EVENT_QUEUES
+
+#include "HostEndpoint.h"
+#include "TestResources.h"
+
+extern Logger logger;
+
+#define OBSERVER_PERIOD_MS      20
+#define OBSERVER_RUN_MS         (10 * OBSERVER_PERIOD_MS + OBSERVER_PERIOD_MS / 2)
+
+// each mechanism behind the same checks
+template <typename T> class ResourceObserverMechanism : public ::testing::Test {
+protected:
+    ResourceObserverMechanism() : m_host(&logger), m_resource(&logger,"3303","5700") {
+        this->m_host.add(&this->m_resource).build();
+        this->m_host.registered();
+    }
+
+    // observations made during ms
+    int observationsDuring(int ms) {
+        int gets = this->m_resource.m_gets.load();
+        ThisThread::sleep_for(ms);
+        return this->m_resource.m_gets.load() - gets;
+    }
+
+    HostEndpoint     m_host;
+    CountingResource m_resource;
+};
+
+typedef ::testing::Types<ThreadedResourceObserver,TickerResourceObserver,EventQueueResourceObserver> ResourceObserverMechanisms;
+TYPED_TEST_CASE(ResourceObserverMechanism,ResourceObserverMechanisms);
+
+TYPED_TEST(ResourceObserverMechanism, IdleUntilObservationBegins) {
+    TypeParam observer(&this->m_resource,OBSERVER_PERIOD_MS);
+    EXPECT_FALSE(observer.isObserving());
+    EXPECT_EQ(0,this->observationsDuring(5 * OBSERVER_PERIOD_MS));
+}
+
+TYPED_TEST(ResourceObserverMechanism, ObservesOncePerSleepTime) {
+    TypeParam observer(&this->m_resource,OBSERVER_PERIOD_MS);
+    observer.beginObservation();
+    ASSERT_TRUE(observer.isObserving());
+
+    // ten periods (the first observation is one period after beginObservation() at the earliest)
+    int observations = this->observationsDuring(OBSERVER_RUN_MS);
+    EXPECT_GE(observations,6);
+    EXPECT_LE(observations,11);
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+    EXPECT_GE(observer.getLatenessHistogram()->count(),(uint32_t)observations);
+#endif
+}
+
+TYPED_TEST(ResourceObserverMechanism, StopObservationStopsObserving) {
+    TypeParam observer(&this->m_resource,OBSERVER_PERIOD_MS);
+    observer.beginObservation();
+    ASSERT_GT(this->observationsDuring(OBSERVER_RUN_MS),0);
+
+    observer.stopObservation();
+    EXPECT_FALSE(observer.isObserving());
+    ThisThread::sleep_for(2 * OBSERVER_PERIOD_MS);
+    EXPECT_EQ(0,this->observationsDuring(5 * OBSERVER_PERIOD_MS));
+
+    // and resumes
+    observer.beginObservation();
+    EXPECT_GT(this->observationsDuring(OBSERVER_RUN_MS),0);
+}
+
+TYPED_TEST(ResourceObserverMechanism, HaltStopsTheMechanism) {
+    TypeParam observer(&this->m_resource,OBSERVER_PERIOD_MS);
+    observer.beginObservation();
+    ASSERT_GT(this->observationsDuring(OBSERVER_RUN_MS),0);
+
+    observer.halt();
+    ThisThread::sleep_for(2 * OBSERVER_PERIOD_MS);
+    EXPECT_EQ(0,this->observationsDuring(5 * OBSERVER_PERIOD_MS));
+}
+
+TYPED_TEST(ResourceObserverMechanism, DestructionStopsObserving) {
+    TypeParam *observer = new TypeParam(&this->m_resource,OBSERVER_PERIOD_MS);
+    observer->beginObservation();
+    ASSERT_GT(this->observationsDuring(OBSERVER_RUN_MS),0);
+
+    delete observer;
+    ThisThread::sleep_for(2 * OBSERVER_PERIOD_MS);
+    EXPECT_EQ(0,this->observationsDuring(5 * OBSERVER_PERIOD_MS));
+}
+
+// a Ticker observes from its (ISR) callback
+TEST(TickerResourceObserver, ObservesFromTheTickerCallback) {
+    class IsrProbe : public CountingResource {
+    public:
+        IsrProbe(const Logger *logger) : CountingResource(logger,"3303","5701"), m_in_isr(0) {}
+        virtual string get() {
+            if (core_util_is_isr_active()) ++this->m_in_isr;
+            return CountingResource::get();
+        }
+        std::atomic<int> m_in_isr;
+    };
+    HostEndpoint host(&logger);
+    IsrProbe resource(&logger);
+    host.add(&resource).build();
+    host.registered();
+
+    TickerResourceObserver observer(&resource,OBSERVER_PERIOD_MS);
+    observer.beginObservation();
+    ThisThread::sleep_for(OBSERVER_RUN_MS);
+    observer.stopObservation();
+    EXPECT_GT(resource.m_in_isr.load(),0);
+}
+
+// the shared EventQueue refuses observers beyond EVENT_QUEUE_OBSERVER_EVENTS
+TEST(EventQueueResourceObserver, FullQueueLeavesTheObserverStopped) {
+    HostEndpoint host(&logger);
+    CountingResource resource(&logger,"3303","5702");
+    host.add(&resource).build();
+    host.registered();
+
+    EventQueueResourceObserver *observers[EVENT_QUEUE_OBSERVER_EVENTS];
+    for (int i = 0; i < EVENT_QUEUE_OBSERVER_EVENTS; ++i) {
+        observers[i] = new EventQueueResourceObserver(&resource,1000);
+        observers[i]->beginObservation();
+        ASSERT_TRUE(observers[i]->isObserving()) << "observer " << i;
+    }
+    EventQueueResourceObserver extra(&resource,1000);
+    extra.beginObservation();
+    EXPECT_FALSE(extra.isObserving());
+
+    // a cancelled observer frees its event
+    delete observers[0];
+    extra.beginObservation();
+    EXPECT_TRUE(extra.isObserving());
+    for (int i = 1; i < EVENT_QUEUE_OBSERVER_EVENTS; ++i) {
+        delete observers[i];
+    }
+}
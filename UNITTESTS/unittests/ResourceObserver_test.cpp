@@ -0,0 +1,114 @@
+/**
+ * @file    ResourceObserver_test.cpp
+ * @brief   Host unit tests for the ResourceObserver base (copy construction, observation timing)
+ */
+
+#include "gtest/gtest.h"
+#include "HostEndpoint.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/ResourceObserver.h"
+#include "mbed-connector-interface/TypedDynamicResource.h"
+
+extern Logger logger;
+
+// observes only when asked to (no underlying mechanism)
+class ManualObserver : public ResourceObserver {
+public:
+    ManualObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,sleep_time) {}
+    ManualObserver(const ManualObserver &observer) : ResourceObserver(observer) {}
+    virtual void beginObservation() { this->setObserving(true); }
+    virtual void stopObservation() { this->setObserving(false); }
+    void observeNow(uint64_t scheduled_ms) { this->observeResource(scheduled_ms); }
+};
+
+// GET takes a while
+class SlowGetResource : public CountingResource {
+public:
+    SlowGetResource(const Logger *logger,const char *res_name,int get_ms) : CountingResource(logger,"3303",res_name), m_get_ms(get_ms) {}
+    virtual string get() {
+        ThisThread::sleep_for(this->m_get_ms);
+        return CountingResource::get();
+    }
+    int m_get_ms;
+};
+
+// typed GET takes a while
+class SlowTypedResource : public TypedDynamicResource<int> {
+public:
+    SlowTypedResource(const Logger *logger,const char *res_name,int get_ms)
+        : TypedDynamicResource<int>(logger,"3303",res_name,"SlowTyped",0,M2MBase::GET_ALLOWED,true), m_get_ms(get_ms), m_gets(0) {}
+    virtual int getTyped() {
+        ThisThread::sleep_for(this->m_get_ms);
+        return ++this->m_gets;
+    }
+    int m_get_ms;
+    std::atomic<int> m_gets;
+};
+
+TEST(ResourceObserver, CopyIsNotObservingAndKeepsTheSleepTime) {
+    CountingResource resource(&logger,"3303","5700");
+    ManualObserver observer(&resource,250);
+    observer.beginObservation();
+    ASSERT_TRUE(observer.isObserving());
+
+    ManualObserver copy(observer);
+    EXPECT_FALSE(copy.isObserving());
+    EXPECT_EQ(250,copy.getSleepTime());
+    copy.observeNow(Kernel::get_ms_count());
+    EXPECT_EQ(0,resource.m_gets.load());
+}
+
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+TEST(ResourceObserver, RecordsGetTimeAndLateness) {
+    HostEndpoint host(&logger);
+    SlowGetResource resource(&logger,"5701",5);
+    host.add(&resource).build();
+    host.registered();
+    ManualObserver observer(&resource,100);
+    observer.beginObservation();
+
+    // observe 20ms after the scheduled time (bind() made the first get())
+    int gets = resource.m_gets.load();
+    uint64_t scheduled_ms = Kernel::get_ms_count();
+    ThisThread::sleep_for(20);
+    observer.observeNow(scheduled_ms);
+    EXPECT_EQ(gets + 1,resource.m_gets.load());
+    EXPECT_EQ(1u,observer.getGetTimeHistogram()->count());
+    EXPECT_GE(observer.getGetTimeHistogram()->max(),5000u);
+    EXPECT_EQ(1u,observer.getLatenessHistogram()->count());
+    EXPECT_GE(observer.getLatenessHistogram()->max(),20u);
+
+    observer.resetTimings();
+    EXPECT_EQ(0u,observer.getGetTimeHistogram()->count());
+    EXPECT_EQ(0u,observer.getLatenessHistogram()->count());
+}
+
+TEST(ResourceObserver, RecordsTypedGetTime) {
+    HostEndpoint host(&logger);
+    SlowTypedResource resource(&logger,"5703",5);
+    host.add(&resource).build();
+    host.registered();
+    ManualObserver observer(&resource,100);
+    observer.beginObservation();
+
+    int gets = resource.m_gets.load();
+    observer.observeNow(Kernel::get_ms_count());
+    EXPECT_EQ(gets + 1,resource.m_gets.load());
+    EXPECT_EQ(1u,observer.getGetTimeHistogram()->count());
+    EXPECT_GE(observer.getGetTimeHistogram()->max(),5000u);
+}
+
+TEST(ResourceObserver, NothingRecordedWhileNotObserving) {
+    HostEndpoint host(&logger);
+    SlowGetResource resource(&logger,"5702",0);
+    host.add(&resource).build();
+    host.registered();
+    ManualObserver observer(&resource,100);
+
+    int gets = resource.m_gets.load();
+    observer.observeNow(Kernel::get_ms_count());
+    EXPECT_EQ(gets,resource.m_gets.load());
+    EXPECT_EQ(0u,observer.getGetTimeHistogram()->count());
+    EXPECT_EQ(0u,observer.getLatenessHistogram()->count());
+}
+#endif
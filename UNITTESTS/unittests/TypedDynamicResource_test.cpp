@@ -0,0 +1,75 @@
+/**
+ * @file    TypedDynamicResource_test.cpp
+ * @brief   Host unit tests for TypedDynamicResource encoding (get()) and decoding (put()/PUT payloads)
+ */
+
+#include "gtest/gtest.h"
+#include "TestResources.h"
+#include "mbed-connector-interface/TypedDynamicResource.h"
+
+#include <float.h>
+#include <limits.h>
+
+extern Logger logger;
+
+// exposes the PUT payload decoder
+template <typename T> class TestTypedResource : public TypedDynamicResource<T> {
+public:
+    TestTypedResource(const char *res_name,const T value) : TypedDynamicResource<T>(&logger,"3303",res_name,"Typed",value,M2MBase::GET_PUT_ALLOWED) {}
+    void putBytes(const char *text) { this->putPayload((uint8_t *)text,(int)strlen(text)); }
+};
+
+// encode the value with get() and decode it back with put()
+template <typename T> static T roundTrip(const T value) {
+    TestTypedResource<T> source("5700",value);
+    TestTypedResource<T> sink("5701",T());
+    sink.put(source.get());
+    return sink.getTyped();
+}
+
+TEST(TypedDynamicResource, IntegersRoundTrip) {
+    const int values[] = { 0, 1, -1, 42, -273, INT_MAX, INT_MIN };
+    for (size_t i = 0; i < sizeof(values)/sizeof(values[0]); ++i) {
+        EXPECT_EQ(values[i],roundTrip<int>(values[i]));
+    }
+    EXPECT_EQ("-273",TestTypedResource<int>("5700",-273).get());
+}
+
+TEST(TypedDynamicResource, FloatsRoundTrip) {
+    const float values[] = { 0.0f, 1.5f, -21.375f, 0.1f, 1.0e-7f, 3.14159274f, 123456.789f, FLT_MAX, -FLT_MAX, FLT_MIN };
+    for (size_t i = 0; i < sizeof(values)/sizeof(values[0]); ++i) {
+        EXPECT_EQ(values[i],roundTrip<float>(values[i])) << "value " << values[i];
+    }
+}
+
+TEST(TypedDynamicResource, FloatsAreNeitherRoundedNorTruncated) {
+    // small values keep their precision, large values fit in the format buffer
+    EXPECT_EQ("1.00000001e-07",TestTypedResource<float>("5700",1.0e-7f).get());
+    EXPECT_EQ("3.40282347e+38",TestTypedResource<float>("5700",FLT_MAX).get());
+    EXPECT_EQ("-21.375",TestTypedResource<float>("5700",-21.375f).get());
+}
+
+TEST(TypedDynamicResource, BooleansRoundTrip) {
+    EXPECT_TRUE(roundTrip<bool>(true));
+    EXPECT_FALSE(roundTrip<bool>(false));
+    EXPECT_EQ("1",TestTypedResource<bool>("5700",true).get());
+    EXPECT_EQ("0",TestTypedResource<bool>("5700",false).get());
+}
+
+TEST(TypedDynamicResource, PutPayloadsAreDecodedIntoTheNativeType) {
+    TestTypedResource<int> integer("5700",0);
+    integer.putBytes("-17");
+    EXPECT_EQ(-17,integer.getTyped());
+    integer.putBytes("not a number");
+    EXPECT_EQ(-17,integer.getTyped());
+
+    TestTypedResource<float> real("5701",0.0f);
+    real.putBytes("2.5e-3");
+    EXPECT_FLOAT_EQ(2.5e-3f,real.getTyped());
+
+    TestTypedResource<bool> boolean("5702",false);
+    boolean.putBytes("true");
+    EXPECT_TRUE(boolean.getTyped());
+    boolean.putBytes("0");
+    EXPECT_FALSE(boolean.getTyped());
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    ConnectionManager.h
+ * @brief   mbed CoAP Endpoint network connection manager with backoff (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CONNECTION_MANAGER_H__
+#define __CONNECTION_MANAGER_H__
+
+// Logger support
+#include "mbed-connector-interface/Logger.h"
+
+// mbed support
+#include "mbed.h"
+
+/** ConnectionManager brings the network interface up with exponential backoff (plus jitter) between failed attempts
+    and re-establishes it after link loss (on its own thread... connect() blocks and must not stall the main loop).
+    Re-registrations after a deregistration we did not ask for are paced by the same backoff (see nextRegistrationDelay())
+ */
+class ConnectionManager {
+    public:
+        // Connection statistics
+        typedef struct {
+            uint32_t    attempts;               // connect() calls made
+            uint32_t    failures;               // connect() calls that failed
+            uint32_t    connects;               // successful connections (initial and reconnections)
+            uint32_t    link_losses;            // disconnections reported by the network interface
+            uint32_t    last_connect_ms;        // time from the first attempt to success (last connection)
+            uint32_t    max_connect_ms;         // worst case time from the first attempt to success
+            uint64_t    total_connect_ms;       // cumulative time from the first attempt to success
+            int         last_error;             // last nsapi_error_t returned by connect()
+        } Statistics;
+
+        /**
+        Default constructor
+        @param logger input logger instance
+        @param initial_backoff_ms input delay after the first failed attempt
+        @param max_backoff_ms input largest delay between attempts (the delay doubles after each failure up to this)
+        @param jitter_percent input up to this percentage of each delay is randomly removed (0 - no jitter)
+        @param max_attempts input attempts per connection before giving up (0 - unlimited)
+        */
+        ConnectionManager(const Logger *logger,
+                          uint32_t initial_backoff_ms = CONNECTION_BACKOFF_INITIAL_MS,
+                          uint32_t max_backoff_ms = CONNECTION_BACKOFF_MAX_MS,
+                          uint32_t jitter_percent = CONNECTION_BACKOFF_JITTER_PERCENT,
+                          uint32_t max_attempts = CONNECTION_MAX_ATTEMPTS);
+
+        /**
+        Destructor
+        */
+        virtual ~ConnectionManager();
+
+        /**
+        Bring the network interface up (blocks, backing off between failed attempts, until connected or max attempts)
+        @param net input the network interface to manage
+        @return NSAPI_ERROR_OK - connected, otherwise the last connect() error
+        */
+        nsapi_error_t connect(NetworkInterface *net);
+
+        /**
+        Set a callback invoked when the link status changes (network stack or reconnection thread context: keep it short, e.g. set an event flag)
+        @param link_changed input the callback
+        */
+        void attach(mbed::Callback<void()> link_changed);
+
+        /**
+        Determine whether the link is up
+        @return true - connected, false - otherwise
+        */
+        bool isConnected() { return this->m_connected; }
+
+        /**
+        Get the delay before the next re-registration attempt: doubles with each attempt (up to the max backoff, jittered)
+        until registrationSucceeded() resets it
+        @return the delay (ms)
+        */
+        uint32_t nextRegistrationDelay();
+
+        /**
+        The endpoint registered... the next re-registration starts again from the initial backoff
+        */
+        void registrationSucceeded();
+
+        /**
+        Get the connection statistics
+        @return the connection statistics
+        */
+        Statistics getStatistics();
+
+        /**
+        Log the connection statistics
+        */
+        void logStatistics();
+
+    private:
+        Logger             *m_logger;
+        NetworkInterface   *m_net;
+        uint32_t            m_initial_backoff_ms;
+        uint32_t            m_max_backoff_ms;
+        uint32_t            m_jitter_percent;
+        uint32_t            m_max_attempts;
+        volatile bool       m_connected;
+        volatile bool       m_stop;
+        Thread             *m_thread;               // reconnection thread (started by the first connect())
+        Semaphore           m_link_lost;            // released by the status callback, taken by the reconnection thread
+        Mutex               m_mutex;                // guards m_stats, m_register_backoff_ms and the jitter PRNG
+        uint32_t            m_attempt;              // attempts made for the current connection (connecting thread only)
+        uint32_t            m_backoff_ms;           // un-jittered delay before the next attempt
+        uint32_t            m_register_backoff_ms;  // un-jittered delay before the next re-registration
+        uint64_t            m_first_attempt_ms;     // start of the current connection
+        uint32_t            m_random;               // jitter PRNG state
+        volatile uint32_t   m_link_losses;          // counted in the status callback (atomic)
+        Statistics          m_stats;
+        mbed::Callback<void()> m_link_changed;
+
+        nsapi_error_t       connectWithBackoff();
+        bool                attempt(uint64_t now);
+        uint32_t            nextDelay();
+        uint32_t            backoff(uint32_t &backoff_ms);
+        uint32_t            random();
+        void                reconnect_task();
+        void                status_changed(nsapi_event_t event,intptr_t status);
+        Logger             *logger();
+};
+
+#endif // __CONNECTION_MANAGER_H__
@@ -78,6 +78,22 @@ class ConnectionStatusInterface {
         Value Updated
         */
         virtual void value_updated(void *ep,void *data,int type);
+        
+        /**
+        Startup phase completed (phases completed before this interface was installed are reported when it is installed)
+        @param ep input the endpoint instance
+        @param phase input the completed phase (StartupTimer::StartupPhase)
+        @param duration_ms input the duration of the phase in ms
+        @param completed_at_ms input when the phase completed (ms since the endpoint was created)
+        */
+        virtual void startup_phase_completed(void *ep,int phase,uint32_t duration_ms,uint32_t completed_at_ms);
+        
+        /**
+        Startup completed (first registration)
+        @param ep input the endpoint instance
+        @param total_ms input ms from endpoint creation to the first registration
+        */
+        virtual void startup_completed(void *ep,uint32_t total_ms);
  };
  
  } // namespace Connector
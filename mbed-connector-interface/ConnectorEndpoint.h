@@ -44,6 +44,12 @@
 // ObjectInstanceManager support
 #include "mbed-connector-interface/ObjectInstanceManager.h"
 
+// DynamicResource dispatch index support
+#include "mbed-connector-interface/DynamicResourceIndex.h"
+
+// Startup phase timing support
+#include "mbed-connector-interface/StartupTimer.h"
+
 // Connector namespace
 namespace Connector  {
 
@@ -165,6 +171,9 @@ public:
     // Registered with mDC/mDS
     bool isRegistered();
     
+    // Registered and the underlying network is connected (notifications can be delivered)
+    bool isOnline();
+    
     /**
     Set the ConnectionStatusInterface instance
     @param csi input instance pointer to the ConnectionStatusInterface implementation to be used
@@ -177,12 +186,40 @@ public:
 	// Get ObjectInstanceManager
 	ObjectInstanceManager *getObjectInstanceManager();
 	
+	// index a DynamicResource as it is bound (value_updated() dispatches only to indexed resources)
+	void indexDynamicResource(DynamicResource *resource);
+	
+	// Get our InboundDispatcher (NULL if inbound requests are processed in the mbed-client context)
+	InboundDispatcher *getInboundDispatcher();
+	
+	// Get our startup phase timings
+	StartupTimer *getStartupTimer();
+	
+	// mark the beginning of a startup phase (StartupTimer::StartupPhase)
+	void startupPhaseBegin(int phase);
+	
+	// mark the completion of a startup phase (logged and reported to the ConnectionStatusInterface)
+	void startupPhaseEnd(int phase);
+	
+	// Get our (opened) NotificationStore (NULL if notifications made while unregistered are discarded)
+	NotificationStore *getNotificationStore();
+	
+	// replay any stored notifications (no-op unless registered)
+	void replayNotifications();
+	
+	// a replay is in progress (new notifications queue behind it to keep their order)
+	bool isReplaying();
+	
+	// Get our NotificationCoalescer (NULL if notifications are sent immediately)
+	NotificationCoalescer *getNotificationCoalescer();
+	
 private:
     Logger            			*m_logger;
     Options           			*m_options;
     bool			   			 m_canActAsRouterNode;
     bool               			 m_connected;
     bool			   			 m_registered;
+    bool						 m_deregistering;		// de_register_endpoint() called: deregistration ends the endpoint
     
 	MbedCloudClient				*m_endpoint_interface;
     M2MObjectList      			 m_endpoint_object_list;
@@ -195,6 +232,30 @@ private:
 	
 	// ObjectInstanceManager
 	ObjectInstanceManager		*m_oim;
+	
+	// M2MBase -> DynamicResource dispatch index (built in buildEndpoint())
+	DynamicResourceIndex		 m_dynamic_resource_index;
+	
+	// optional InboundDispatcher
+	InboundDispatcher			*m_inbound_dispatcher;
+	
+	// startup phase timings
+	StartupTimer				 m_startup_timer;
+	
+	// background resolver for lazily bound values (created only if needed)
+	Thread						*m_lazy_bind_thread;
+	
+	// offline notification store and its replay thread (created only if needed)
+	NotificationStore			*m_notification_store;
+	Thread						*m_replay_thread;
+	Mutex						 m_replay_mutex;		// serializes starting the replay thread (notify() runs on any observer thread)
+	Semaphore					*m_replay_signal;
+	uint8_t						*m_replay_buffer;		// one MAX_VALUE_BUFFER_LENGTH payload (heap... keeps the replay stack small)
+	volatile bool				 m_replaying;
+	volatile bool				 m_replay_stop;
+	
+	// optional NotificationCoalescer
+	NotificationCoalescer		*m_coalescer;
 
 	// create our endpoint interface
 	void 			 createEndpointInterface();
@@ -212,6 +273,18 @@ private:
 	
 	// stop underlying observers
     void stopObservations();
+    
+    // resolve lazily bound values (background thread)
+    void resolvePendingValues();
+    
+    // wait for the lazy value resolver to finish and free it
+    void joinLazyBindThread();
+    
+    // replay stored notifications (background thread)
+    void replayTask();
+    
+    // DynamicResource lookup by full name (i.e. "3303/0/5700")
+    DynamicResource *lookupDynamicResource(const char *full_name);
 };
 
 } // namespace Connector
@@ -95,6 +95,17 @@ public:
     */
     uint8_t process(M2MBase::Operation op,M2MBase::BaseType type,void *args = NULL);
 
+    /**
+    Process the CoAP message against a given payload (e.g. a copy of the resource value taken when the request was queued)
+    @param op input the CoAP Verb (operation)
+    @param type input clarification of the M2MBase instance being passed in (Object vs. ObjectInstance vs. Resource vs. ResourceInstance)
+    @param payload input the request payload
+    @param payload_length input the request payload length
+    @param args input arguments (unused)
+    @return 0 - success, 1 - failure
+    */
+    uint8_t process(M2MBase::Operation op,M2MBase::BaseType type,uint8_t *payload,int payload_length,void *args = NULL);
+
     /**
     Resource value getter (REQUIRED: must be implemented in derived class as all Binders MUST support and implement GET)
     @returns string value of the resource
@@ -124,7 +135,30 @@ public:
     @param data input the new data to update
     @returns 1 - success, 0 - failure
     */
-    int notify(const string data);
+    int notify(const string &data);
+
+    /**
+    Send notification of new data (no intermediate string: written straight into the resource value, or wrapped in place if a DataWrapper is set)
+    @param data input the new data to update
+    @param data_length input the length of the new data
+    @returns 1 - success, 0 - failure
+    */
+    int notify(const uint8_t *data,int data_length);
+
+    /**
+    Send notification of new data (character buffer convenience)
+    @param data input the new data to update
+    @param data_length input the length of the new data
+    @returns 1 - success, 0 - failure
+    */
+    int notify(const char *data,int data_length) { return this->notify((const uint8_t *)data,data_length); }
+
+    /**
+    Write a stored or coalesced notification (already wrapped: written straight into the resource value)
+    @param data input the held payload
+    @param data_length input the length of the held payload
+    */
+    void replayNotification(const uint8_t *data,int data_length);
 
     /**
     Determine whether this dynamic resource is observable or not
@@ -139,7 +173,7 @@ public:
     void setObserver(void *observer);
 
     /**
-    Set the content format for responses
+    Set the content format for responses (42 - application/octet-stream: numeric payloads are decoded as LwM2M binary, otherwise as text)
     @param content_format short integer CoAP content-format ID
     */
     void setContentFormat(uint8_t content_format);
@@ -160,6 +194,96 @@ public:
     observe the resource
     */
     virtual void observe();
+
+    /**
+    Enable/disable change suppression for observations (unchanged values are not re-sent)
+    @param enable input true - suppress notifications whose payload is unchanged, false - notify every period (default)
+    @param force_refresh_periods input force a notification after this many consecutive suppressed periods (0 - never force)
+    */
+    void setChangeSuppression(bool enable,uint32_t force_refresh_periods = 0);
+
+    /**
+    Determine whether change suppression is enabled
+    @returns true - enabled, false - otherwise
+    */
+    bool changeSuppressionEnabled() { return this->m_suppress_unchanged; }
+
+    /**
+    Get the number of observation notifications suppressed because the value was unchanged
+    @returns the suppressed notification count
+    */
+    uint32_t getSuppressedNotificationCount() { return this->m_suppressed_count; }
+
+    /**
+    Get the number of observation notifications emitted
+    @returns the emitted notification count
+    */
+    uint32_t getEmittedNotificationCount() { return this->m_emitted_count; }
+
+    /**
+    Set the minimum period (LwM2M pmin): observations are not notified sooner than this after the last notification
+    @param pmin_ms input the minimum period in ms (0 - unset)
+    */
+    void setMinimumPeriod(uint32_t pmin_ms);
+
+    /**
+    Set the maximum period (LwM2M pmax): a notification is always sent once this has elapsed since the last notification
+    @param pmax_ms input the maximum period in ms (0 - unset)
+    */
+    void setMaximumPeriod(uint32_t pmax_ms);
+
+    /**
+    Set the greater-than threshold (LwM2M gt): notify when a numeric value crosses above/below this threshold
+    @param gt input the threshold
+    */
+    void setGreaterThan(float gt);
+
+    /**
+    Set the less-than threshold (LwM2M lt): notify when a numeric value crosses below/above this threshold
+    @param lt input the threshold
+    */
+    void setLessThan(float lt);
+
+    /**
+    Set the step (LwM2M st): notify when a numeric value has moved by at least this much since the last notification
+    @param st input the step
+    */
+    void setStep(float st);
+
+    /**
+    Clear all notification attributes (observations revert to notifying every period)
+    */
+    void clearNotificationAttributes();
+
+    /**
+    Determine whether any notification attributes are set
+    @returns true - attributes set, false - otherwise
+    */
+    bool hasNotificationAttributes() { return this->m_attributes != 0; }
+
+    /**
+    Enable/disable lazy binding: bind() does not call get() but registers the initial (placeholder) value. The real value
+    is resolved by the first observation or by the endpoint's background resolver (use for slow sensors)
+    @param lazy input true - lazy bind, false - get() during bind() (default)
+    */
+    void setLazyBind(bool lazy);
+
+    /**
+    Determine whether lazy binding is enabled
+    @returns true - enabled, false - otherwise
+    */
+    bool lazyBind() { return this->m_lazy_bind; }
+
+    /**
+    Determine whether the bound value is still the lazy bind placeholder
+    @returns true - placeholder pending resolution, false - otherwise
+    */
+    bool isValuePending() { return this->m_value_pending != 0; }
+
+    /**
+    Resolve the placeholder value left by a lazy bind() (calls get() and writes the value; no-op otherwise)
+    */
+    void resolvePendingValue();
     
     /**
     get the base resource representation
@@ -180,6 +304,11 @@ public:
     Determine if we are registered or not
     */
     bool isRegistered();
+
+    /**
+    Determine if an observation should be made now (registered, or unregistered with a NotificationStore to record it)
+    */
+    bool canObserve();
     
     /** 
     Get our Observer
@@ -187,13 +316,27 @@ public:
     void *getObserver(); 
 
 protected:
-    int               notify(uint8_t *data,int data_length);
     DataWrapper      *getDataWrapper() { return this->m_data_wrapper; }
+    int               observeValue(const uint8_t *data,int data_length);
+    virtual void      putPayload(uint8_t *data,int data_length);
     bool              m_observable;
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+    void              recordGetTime(uint32_t start_us);
+#endif
+
+    // allocation free payload decoders (LwM2M binary encoding if binary is set, text otherwise)
+    bool              binaryContent();
+    static bool       decodeInteger(const uint8_t *data,int data_length,int &value,bool binary);
+    static bool       decodeFloat(const uint8_t *data,int data_length,float &value,bool binary);
+    static int        textLength(const uint8_t *data,int data_length);
+    static bool       parseTextInteger(const uint8_t *data,int data_length,int &value);
+    static bool       parseTextFloat(const uint8_t *data,int data_length,float &value);
+    static bool       parseBinaryInteger(const uint8_t *data,int data_length,int &value);
+    static bool       parseBinaryFloat(const uint8_t *data,int data_length,float &value);
 
 private:
 
-    string                 			   m_res_type;			// a string description of our resource type (i.e. "Counter", etc...)  
+    const char             			  *m_res_type;			// interned description of our resource type (i.e. "Counter", etc...)  
     ResourceType					   m_type;				// the core type of our resource (i.e. String, Integer, etc...) 
     uint8_t               			   m_res_mask;
     uint8_t               			   m_obs_number;
@@ -204,9 +347,45 @@ private:
     M2MResource				          *m_res;
     void                              *m_ep;
 
+    // change suppression
+    bool                               m_suppress_unchanged;
+    uint32_t                           m_force_refresh_periods;
+    uint32_t                           m_periods_since_emit;
+    uint32_t                           m_last_hash;
+    int                                m_last_length;       // -1 until the first emitted notification
+    uint32_t                           m_suppressed_count;
+    uint32_t                           m_emitted_count;
+
+    static uint32_t                    hashValue(const uint8_t *data,int data_length);
+
+    // notification attributes (pmin/pmax/gt/lt/st)
+    uint8_t                            m_attributes;        // bitmask of NOTIFY_ATTR_* set
+    uint32_t                           m_pmin_ms;
+    uint32_t                           m_pmax_ms;
+    float                              m_gt;
+    float                              m_lt;
+    float                              m_st;
+    bool                               m_notified;          // at least one notification emitted
+    uint64_t                           m_last_notify_ms;
+    bool                               m_last_value_valid;
+    float                              m_last_value;        // last notified numeric value
+    bool                               m_change_pending;    // a change was held back by pmin... notify once pmin has elapsed
+
+    // lazy binding
+    bool                               m_lazy_bind;
+    volatile uint8_t                   m_value_pending;     // bound with a placeholder value, get() not yet called (claimed atomically)
+
+    bool                               attributesAllowNotify(const uint8_t *data,int data_length,uint64_t now,bool &pmax_due,bool &have_value,float &value);
+    bool                               attributesChanged(bool have_value,float value);
+    bool                               claimPendingValue();
+
 public:
     // convenience method to create a string from the NSDL CoAP data buffers...
     string coapDataToString(uint8_t *coap_data_ptr,int coap_data_ptr_length);
+
+    // convenience methods to decode numeric NSDL CoAP data buffers (no allocation): plain text ("42", "-3.5"), or the LwM2M
+    // binary encodings (big-endian 1/2/4/8 byte integers, 4/8 byte IEEE754 floats) if our content format is application/octet-stream (42).
+    // 0 if undecodable.
     int coapDataToInteger(uint8_t *coap_data_ptr,int coap_data_ptr_length);
     float coapDataToFloat(uint8_t *coap_data_ptr,int coap_data_ptr_length);
     void *coapDataToOpaque(uint8_t *coap_data_ptr,int coap_data_ptr_length);
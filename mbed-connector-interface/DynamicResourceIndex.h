@@ -0,0 +1,108 @@
+/**
+ * @file    DynamicResourceIndex.h
+ * @brief   mbed CoAP Endpoint M2MBase to DynamicResource dispatch index (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DYNAMIC_RESOURCE_INDEX_H__
+#define __DYNAMIC_RESOURCE_INDEX_H__
+
+// DynamicResource support
+#include "mbed-connector-interface/DynamicResource.h"
+
+// Vector support
+#include <vector>
+
+/** DynamicResourceIndex maps the underlying M2MBase instance of a bound DynamicResource back to the DynamicResource (open addressed hash, O(1) lookup)
+ */
+class DynamicResourceIndex {
+    public:
+        /**
+        Default constructor
+        */
+        DynamicResourceIndex();
+
+        /**
+        Copy constructor
+        @param index input the DynamicResourceIndex that is to be deep copied
+        */
+        DynamicResourceIndex(const DynamicResourceIndex &index);
+
+        /**
+        Assignment operator
+        @param index input the DynamicResourceIndex that is to be deep copied
+        @return this DynamicResourceIndex
+        */
+        DynamicResourceIndex &operator=(DynamicResourceIndex index);
+
+        /**
+        Destructor
+        */
+        virtual ~DynamicResourceIndex();
+
+        /**
+        (Re)build the index from a list of bound dynamic resources
+        @param resources input the list of dynamic resources (only resources that have been bound are indexed)
+        */
+        void build(const vector<DynamicResource *> *resources);
+
+        /**
+        Index a bound dynamic resource (the index grows as needed)
+        @param resource input the DynamicResource (must have been bound)
+        @return true - indexed, false - not bound or unable to allocate
+        */
+        bool add(DynamicResource *resource);
+
+        /**
+        Lookup the DynamicResource for a given M2MBase instance
+        @param base input the M2MBase instance
+        @return the DynamicResource or NULL if not indexed
+        */
+        DynamicResource *lookup(const void *base);
+
+        /**
+        Determine whether the index has been built
+        @return true - built, false - otherwise
+        */
+        bool isBuilt() { return this->m_capacity > 0; }
+
+        /**
+        Get the number of indexed resources
+        @return the number of indexed resources
+        */
+        int size() { return this->m_size; }
+
+        /**
+        Clear the index
+        */
+        void clear();
+
+    private:
+        const void      **m_keys;
+        DynamicResource **m_values;
+        int               m_capacity;       // always a power of 2
+        int               m_size;
+
+        int               slot(const void *key);
+        bool              resize(int capacity);
+        void              swap(DynamicResourceIndex &index);
+        void              insert(const void *key,DynamicResource *value);
+};
+
+#endif // __DYNAMIC_RESOURCE_INDEX_H__
@@ -60,9 +60,9 @@ class EventQueueResourceObserver : public ResourceObserver {
         virtual void stopObservation();
         
         /**
-        observation task method (static)
+        observation task method (bound to this instance, invoked from the shared EventQueue thread)
         */
-        static void observation_task();
+        void observation_task();
         
         /**
         halt the underlying observer mechanism
@@ -70,8 +70,10 @@ class EventQueueResourceObserver : public ResourceObserver {
         virtual void halt();
         
     private: 
-        EventQueue  m_event_queue;
-        int m_id;
+        int m_id;                   // our periodic event in the shared EventQueue (0 - not scheduled)
+
+        // the shared EventQueue (created and dispatched on first use)
+        static EventQueue *sharedEventQueue();
 };
 
 #endif // CONNECTOR_USING_EVENT_QUEUES
@@ -0,0 +1,72 @@
+/**
+ * @file    FileNotificationStore.h
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue (file backend) (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FILE_NOTIFICATION_STORE_H__
+#define __FILE_NOTIFICATION_STORE_H__
+
+// Base class
+#include "mbed-connector-interface/NotificationStore.h"
+
+// stdio support
+#include <stdio.h>
+
+/** FileNotificationStore keeps recorded notifications in a fixed size file (i.e. on the "/fs" filesystem) so that they survive a
+    reset. Only stdio is used, so the store also works against a local file on a host.
+ */
+class FileNotificationStore : public NotificationStore {
+    public:
+        /**
+        Default constructor
+        @param path input the file path (i.e. "/fs/notifications.dat")
+        @param capacity input bytes of record storage (the file is this plus a small header)
+        */
+        FileNotificationStore(const char *path,uint32_t capacity = NOTIFICATION_STORE_FILE_LENGTH);
+
+        /**
+        Destructor
+        */
+        virtual ~FileNotificationStore();
+
+        /**
+        Open the store (restores the records of a previous file with the same capacity, otherwise starts empty)
+        @return true - ready, false - unable to open/create the file
+        */
+        virtual bool open();
+
+        /**
+        Close the file
+        */
+        void close();
+
+    protected:
+        virtual bool readAt(uint32_t offset,uint8_t *buffer,uint32_t length);
+        virtual bool writeAt(uint32_t offset,const uint8_t *buffer,uint32_t length);
+        virtual bool saveState();
+
+    private:
+        char                m_path[NOTIFICATION_STORE_PATH_LENGTH+1];
+        FILE               *m_file;
+
+        bool                loadState();
+};
+
+#endif // __FILE_NOTIFICATION_STORE_H__
@@ -0,0 +1,124 @@
+/**
+ * @file    IdentifierTable.h
+ * @brief   mbed CoAP Endpoint shared object/resource identifier table (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __IDENTIFIER_TABLE_H__
+#define __IDENTIFIER_TABLE_H__
+
+// mbed support
+#if defined(MCI_USE_YOTTA)
+    #include "mbed-drivers/mbed.h"
+#else
+    #include "mbed.h"
+#endif
+
+// String and Vector support
+#include <string>
+#include <vector>
+
+// Identifier handle: LwM2M numeric IDs ("3303", "5700") are the number itself, other names are interned strings
+typedef uint32_t IdentifierHandle;
+#define IDENTIFIER_INTERNED_FLAG    0x80000000
+#define IDENTIFIER_INVALID          0xFFFFFFFF
+#define IDENTIFIER_MAX_DIGITS       9                       // numeric IDs are kept below IDENTIFIER_INTERNED_FLAG
+
+/** IdentifierTable is the (process wide) table of object and resource identifiers. Comparing two handles is a single integer compare.
+ */
+class IdentifierTable {
+    public:
+        /**
+        Get the shared identifier table
+        @return the IdentifierTable instance
+        */
+        static IdentifierTable *instance();
+
+        /**
+        Get the handle for an identifier (numeric identifiers are not stored at all)
+        @param name input the identifier
+        @return the identifier handle (IDENTIFIER_INVALID if name is NULL or cannot be stored)
+        */
+        IdentifierHandle intern(const char *name);
+
+        /**
+        Get the handle for an identifier that must always be available as a string (e.g. a resource type)
+        @param name input the identifier
+        @return the (interned string) identifier handle (IDENTIFIER_INVALID if name is NULL or cannot be stored)
+        */
+        IdentifierHandle internString(const char *name);
+
+        /**
+        Determine whether a handle is a numeric identifier
+        @param handle input the identifier handle
+        @return true - numeric, false - interned string (or invalid)
+        */
+        static bool isNumeric(IdentifierHandle handle) { return (handle & IDENTIFIER_INTERNED_FLAG) == 0; }
+
+        /**
+        Get the interned string for a handle (the pointer remains valid for the life of the process)
+        @param handle input the identifier handle
+        @return the interned string, or NULL for numeric/invalid handles
+        */
+        const char *str(IdentifierHandle handle);
+
+        /**
+        Render any handle as text
+        @param handle input the identifier handle
+        @param buffer input a buffer for numeric identifiers
+        @param buffer_length input the length of the buffer
+        @return the identifier text (the interned string, or buffer)
+        */
+        const char *toString(IdentifierHandle handle,char *buffer,int buffer_length);
+
+        /**
+        Render any handle as a string
+        @param handle input the identifier handle
+        @return the identifier string
+        */
+        string toString(IdentifierHandle handle);
+
+        /**
+        Get the (shared) string for any handle... numeric identifiers are rendered once and kept in the table
+        @param handle input the identifier handle
+        @return the identifier string (the reference remains valid for the life of the process)
+        */
+        const string &name(IdentifierHandle handle);
+
+        /**
+        Get the number of strings held by the table
+        @return the number of interned (and rendered numeric) strings
+        */
+        int size();
+
+    private:
+        IdentifierTable();
+        IdentifierTable(const IdentifierTable &table);
+
+        Mutex            m_mutex;
+        vector<string *> m_strings;             // never freed: handed out pointers/references stay valid
+        int             *m_hash;                // open addressed: indices into m_strings (-1 empty)
+        int              m_hash_capacity;       // power of 2
+
+        IdentifierHandle internLocked(const char *name);
+        bool             growHash();
+        static uint32_t  hashOf(const char *name);
+};
+
+#endif // __IDENTIFIER_TABLE_H__
@@ -0,0 +1,165 @@
+/**
+ * @file    InboundDispatcher.h
+ * @brief   mbed CoAP Endpoint asynchronous inbound request dispatcher (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __INBOUND_DISPATCHER_H__
+#define __INBOUND_DISPATCHER_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+// mbed support
+#include "mbed.h"
+#include "rtos.h"
+
+// DynamicResource support
+#include "mbed-connector-interface/DynamicResource.h"
+
+/** InboundDispatcher queues inbound CoAP operations and runs DynamicResource::process() on its own worker thread
+ */
+class InboundDispatcher {
+    public:
+        // What to do when the queue is full
+        typedef enum {
+            DROP_NEWEST,                // discard the inbound request
+            DROP_OLDEST,                // discard the oldest queued request to make room
+            PROCESS_INLINE              // process the inbound request in the caller's context
+        } OverflowPolicy;
+
+        // Operation classes that statistics are kept for
+        typedef enum {
+            OPERATION_PUT,
+            OPERATION_POST,
+            OPERATION_DELETE,
+            OPERATION_OTHER,
+            OPERATION_NUM_TYPES
+        } OperationClass;
+
+        // Per-operation statistics
+        typedef struct {
+            uint32_t    queued;                 // requests accepted onto the queue
+            uint32_t    processed;              // requests processed (queued or inline)
+            uint32_t    dropped;                // requests discarded by the overflow policy
+            uint32_t    inlined;                // requests processed inline due to overflow
+            uint64_t    total_queue_wait_us;    // cumulative time spent waiting in the queue
+            uint32_t    max_queue_wait_us;      // worst case time spent waiting in the queue
+            uint64_t    total_exec_us;          // cumulative time spent in process()
+            uint32_t    max_exec_us;            // worst case time spent in process()
+        } Statistics;
+
+        /**
+        Default constructor
+        @param logger input logger instance
+        @param depth input the maximum number of queued requests
+        @param policy input the overflow policy when the queue is full
+        */
+        InboundDispatcher(const Logger *logger,int depth = DEFAULT_INBOUND_DISPATCH_DEPTH,OverflowPolicy policy = PROCESS_INLINE);
+
+        /**
+        Destructor
+        */
+        virtual ~InboundDispatcher();
+
+        /**
+        Start the worker thread
+        @return true - started, false - otherwise
+        */
+        bool start();
+
+        /**
+        Halt the worker thread (waits for the request in progress, discards those still queued)
+        */
+        void halt();
+
+        /**
+        Dispatch an inbound operation to a DynamicResource
+        @param resource input the target DynamicResource
+        @param op input the CoAP operation
+        @param type input the M2MBase type of the target
+        @return true - queued or processed, false - dropped
+        */
+        bool dispatch(DynamicResource *resource,M2MBase::Operation op,M2MBase::BaseType type);
+
+        /**
+        Get the statistics for a given operation class
+        @param op input the operation class
+        @return a snapshot of the statistics
+        */
+        Statistics getStatistics(OperationClass op);
+
+        /**
+        Reset all statistics
+        */
+        void resetStatistics();
+
+        /**
+        Log a summary of the statistics
+        */
+        void logStatistics();
+
+        /**
+        Get the queue depth
+        */
+        int getDepth() { return this->m_depth; }
+
+        /**
+        Get the number of currently queued requests
+        */
+        int getPending();
+
+        /**
+        Get the overflow policy
+        */
+        OverflowPolicy getOverflowPolicy() { return this->m_policy; }
+
+    private:
+        // a queued inbound request (the payload is copied from the resource when the request is queued)
+        typedef struct {
+            DynamicResource    *resource;
+            M2MBase::Operation  op;
+            M2MBase::BaseType   type;
+            uint32_t            enqueued_us;
+            uint8_t            *payload;
+            int                 payload_length;
+        } Request;
+
+        Logger            *m_logger;
+        Request           *m_queue;
+        int                m_depth;
+        int                m_head;
+        int                m_count;
+        OverflowPolicy     m_policy;
+        bool               m_running;          // guarded by m_mutex (dispatch() checks it and enqueues atomically w.r.t. halt())
+        volatile bool      m_stop;
+        Statistics         m_stats[OPERATION_NUM_TYPES];
+        Mutex              m_mutex;
+        Semaphore          m_pending;
+        Thread             m_thread;
+
+        void               dispatch_task();
+        void               execute(const Request &request,uint32_t dequeued_us);
+        bool               snapshot(Request *request);
+        void               discard(Request *request);
+        OperationClass     classify(M2MBase::Operation op);
+        Logger            *logger();
+};
+
+#endif // __INBOUND_DISPATCHER_H__
@@ -41,6 +41,62 @@
 // logging macro
 #define log(x, ...)  logIt(x"\r\n",##__VA_ARGS__)
 
+// log severity levels
+#define LOGGER_LEVEL_NONE       0
+#define LOGGER_LEVEL_ERROR      1
+#define LOGGER_LEVEL_WARN       2
+#define LOGGER_LEVEL_INFO       3
+#define LOGGER_LEVEL_DEBUG      4
+#define LOGGER_LEVEL_TRACE      5
+
+// log modules (components)
+#define LOGGER_MODULE_ENDPOINT  0x01
+#define LOGGER_MODULE_RESOURCE  0x02
+#define LOGGER_MODULE_OBSERVER  0x04
+#define LOGGER_MODULE_OIM       0x08
+#define LOGGER_MODULE_NETWORK   0x10
+#define LOGGER_MODULE_ALL       0xFF
+
+// leveled logging: compiled out entirely (arguments included) when the level is above LOGGER_COMPILE_LEVEL or the module
+// is not in LOGGER_COMPILE_MODULES, otherwise filtered at runtime against Logger::setLevel()/setModules(). Compiled out
+// statements still name their arguments (unevaluated, inside sizeof) so values only logged raise no unused warnings
+#define LOGGER_STATEMENT(logger,level,module,x, ...) \
+    do { \
+        if (((module) & (LOGGER_COMPILE_MODULES)) != 0) { \
+            Logger *__logger = (logger); \
+            if (__logger != NULL && __logger->isEnabled((level),(module))) __logger->logIt(x"\r\n",##__VA_ARGS__); \
+        } \
+    } while(0)
+static inline int logger_discard(const void * /* logger */,int /* module */,const char * /* format */,...) { return 0; }
+#define LOGGER_NOOP(logger,module,x, ...) \
+    do { (void)sizeof(logger_discard((logger),(module),x,##__VA_ARGS__)); } while(0)
+
+#if LOGGER_COMPILE_LEVEL >= LOGGER_LEVEL_ERROR
+    #define LOG_ERROR(logger,module,x, ...)  LOGGER_STATEMENT(logger,LOGGER_LEVEL_ERROR,module,x,##__VA_ARGS__)
+#else
+    #define LOG_ERROR(logger,module,x, ...)  LOGGER_NOOP(logger,module,x,##__VA_ARGS__)
+#endif
+#if LOGGER_COMPILE_LEVEL >= LOGGER_LEVEL_WARN
+    #define LOG_WARN(logger,module,x, ...)   LOGGER_STATEMENT(logger,LOGGER_LEVEL_WARN,module,x,##__VA_ARGS__)
+#else
+    #define LOG_WARN(logger,module,x, ...)   LOGGER_NOOP(logger,module,x,##__VA_ARGS__)
+#endif
+#if LOGGER_COMPILE_LEVEL >= LOGGER_LEVEL_INFO
+    #define LOG_INFO(logger,module,x, ...)   LOGGER_STATEMENT(logger,LOGGER_LEVEL_INFO,module,x,##__VA_ARGS__)
+#else
+    #define LOG_INFO(logger,module,x, ...)   LOGGER_NOOP(logger,module,x,##__VA_ARGS__)
+#endif
+#if LOGGER_COMPILE_LEVEL >= LOGGER_LEVEL_DEBUG
+    #define LOG_DEBUG(logger,module,x, ...)  LOGGER_STATEMENT(logger,LOGGER_LEVEL_DEBUG,module,x,##__VA_ARGS__)
+#else
+    #define LOG_DEBUG(logger,module,x, ...)  LOGGER_NOOP(logger,module,x,##__VA_ARGS__)
+#endif
+#if LOGGER_COMPILE_LEVEL >= LOGGER_LEVEL_TRACE
+    #define LOG_TRACE(logger,module,x, ...)  LOGGER_STATEMENT(logger,LOGGER_LEVEL_TRACE,module,x,##__VA_ARGS__)
+#else
+    #define LOG_TRACE(logger,module,x, ...)  LOGGER_NOOP(logger,module,x,##__VA_ARGS__)
+#endif
+
 /** Logger class
  */
 class Logger
@@ -70,8 +126,96 @@ public:
     */
     void logIt(const char *format, ...);
 
+    /**
+    Set the runtime severity threshold (only statements compiled in via LOGGER_COMPILE_LEVEL can be enabled)
+    @param level input the most verbose level to output (LOGGER_LEVEL_NONE ... LOGGER_LEVEL_TRACE)
+    */
+    void setLevel(int level) { this->m_level = level; }
+
+    /**
+    Get the runtime severity threshold
+    @return the most verbose level being output
+    */
+    int getLevel() { return this->m_level; }
+
+    /**
+    Set the runtime module filter
+    @param modules input OR of the LOGGER_MODULE_* values to output
+    */
+    void setModules(uint32_t modules) { this->m_modules = modules; }
+
+    /**
+    Determine whether a given level/module is enabled at runtime
+    @param level input the statement severity level
+    @param module input the statement module
+    @return true - enabled, false - filtered
+    */
+    bool isEnabled(int level,uint32_t module) { return level <= this->m_level && (module & this->m_modules) != 0; }
+
+    /**
+    Switch to asynchronous logging: records are copied into a lock-free ring buffer and written out by a low priority thread
+    @param ring_length input the ring buffer length in bytes (power of 2)
+    @return true - asynchronous logging started, false - otherwise (logging remains synchronous)
+    */
+    bool startAsync(int ring_length = LOGGER_ASYNC_RING_LENGTH);
+
+    /**
+    Switch to binary asynchronous logging: only the format string address and the raw arguments are recorded, nothing is
+    formatted on the device. Output is framed binary that tools/decode_binary_log.py turns back into text using the ELF image.
+    @param ring_length input the ring buffer length in bytes (power of 2)
+    @return true - binary logging started, false - otherwise
+    */
+    bool startBinary(int ring_length = LOGGER_ASYNC_RING_LENGTH);
+
+    /**
+    Determine whether asynchronous logging is active
+    @return true - asynchronous, false - synchronous
+    */
+    bool isAsync() { return this->m_async != NULL; }
+
+    /**
+    Determine whether binary logging is active
+    @return true - binary, false - text
+    */
+    bool isBinary() { return this->m_async != NULL && this->m_async->binary == true; }
+
+    /**
+    Wait (bounded) for buffered asynchronous log records to be written out
+    @param timeout_ms input the maximum time to wait in ms
+    */
+    void flush(int timeout_ms = 1000);
+
+    /**
+    Get the number of log records dropped because the asynchronous ring buffer was full
+    @return the dropped record count
+    */
+    uint32_t getDroppedCount();
+
 private:
-    Serial  *m_pc;
+    // asynchronous logging state (shared with copies of this Logger)
+    typedef struct {
+        uint8_t           *ring;
+        uint32_t           ring_length;
+        volatile uint32_t  head;                // reservation index (producers)
+        volatile uint32_t  tail;                // drain index (drain thread)
+        volatile uint32_t  dropped;
+        uint32_t           dropped_reported;
+        Semaphore         *pending;
+        Thread            *thread;
+        bool               binary;              // records are binary (format address + raw arguments)
+    } AsyncState;
+
+    Serial     *m_pc;
+    int         m_level;
+    uint32_t    m_modules;
+    AsyncState *m_async;
+    bool        m_async_owner;
+
+    bool        enqueue(const char *data,int length,uint32_t flags = 0);
+    int         encodeBinary(uint8_t *record,const char *format,va_list args);
+    void        writeBinaryFrame(const uint8_t *record,int length);
+    void        drain();
+    void        drain_task();
 };
 
 #endif // __LOGGER_H__
@@ -26,36 +26,57 @@
 // String class
 #include <string>
 
+// shared identifiers
+#include "mbed-connector-interface/IdentifierTable.h"
+
 class NamedPointer {
 public:
     // constructor
-    NamedPointer(string name,void *ptr,int index);
+    NamedPointer(IdentifierHandle id,void *ptr,int index);
     
-    // copy constructor
+    // copy constructor (deep copies any associated list)
     NamedPointer(const NamedPointer &np);
     
+    // assignment (deep copies any associated list)
+    NamedPointer &operator=(const NamedPointer &np);
+    
+#if __cplusplus >= 201103L
+    // move constructor (takes over any associated list... lets vectors grow without deep copies)
+    NamedPointer(NamedPointer &&np) noexcept;
+    
+    // move assignment
+    NamedPointer &operator=(NamedPointer &&np) noexcept;
+#endif
+    
     // Destructor
     virtual ~NamedPointer();
     
     // Get the Name
-    string name();
+    const string &name();
+    
+    // Get the identifier handle
+    IdentifierHandle id() { return this->m_id; }
     
     // Get the Pointer
-    void *ptr();
+    void *ptr() const;
     
-    // Get the associated list
+    // Get the associated list (created on first use)
     void *list();
     
+    // Get the size of the associated list (does not create it)
+    int listSize();
+    
     // Get our associated index
     int index();
     
 private:
-    string   m_name;
+    IdentifierHandle m_id;
     int      m_index;
     void    *m_ptr; 
     void    *m_list;
     
     void    *copyList(void *list);
+    void     freeList();
 };
 
 #endif // __NAMED_POINTER_H__
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file    NotificationCoalescer.h
+ * @brief   mbed CoAP Endpoint notification coalescing window (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NOTIFICATION_COALESCER_H__
+#define __NOTIFICATION_COALESCER_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+// mbed support
+#include "mbed.h"
+#include "rtos.h"
+
+// DynamicResource support
+#include "mbed-connector-interface/DynamicResource.h"
+
+/** NotificationCoalescer holds notifications for a short window (opened by the first notification) and then writes all of
+    them to mbed-client together from the endpoint main loop, so that observers with similar periods share one uplink burst.
+    A resource notified more than once within a window only sends its latest value.
+ */
+class NotificationCoalescer {
+    public:
+        // Coalescing statistics
+        typedef struct {
+            uint32_t    submitted;              // notifications accepted into a window
+            uint32_t    superseded;             // notifications replaced by a later value within the same window
+            uint32_t    overflowed;             // notifications sent immediately because the window was full
+            uint32_t    batches;                // windows flushed
+            uint32_t    flushed;                // notifications written by flushes
+            uint32_t    max_batch;              // largest number of notifications written by one flush
+            uint64_t    total_latency_us;       // cumulative delay added to flushed notifications
+            uint32_t    max_latency_us;         // worst case delay added to a flushed notification
+        } Statistics;
+
+        /**
+        Default constructor
+        @param logger input logger instance
+        @param window_ms input the coalescing window (ms)
+        @param depth input the maximum number of resources pending in one window
+        */
+        NotificationCoalescer(const Logger *logger,uint32_t window_ms,int depth = NOTIFICATION_COALESCE_DEPTH);
+
+        /**
+        Destructor
+        */
+        virtual ~NotificationCoalescer();
+
+        /**
+        Hold a notification until the current window closes (the payload is copied)
+        @param resource input the notifying DynamicResource
+        @param data input the (wrapped) payload
+        @param data_length input the payload length
+        @return true - held, false - not held, i.e. window full or ISR context (the caller should send it now)
+        */
+        bool submit(DynamicResource *resource,const uint8_t *data,int data_length);
+
+        /**
+        Write all held notifications now (closes the current window)
+        */
+        void flush();
+
+        /**
+        Get the coalescing window (ms)
+        */
+        uint32_t getWindow() { return this->m_window_ms; }
+
+        /**
+        Get a snapshot of the statistics
+        */
+        Statistics getStatistics();
+
+        /**
+        Reset all statistics
+        */
+        void resetStatistics();
+
+        /**
+        Log a summary of the statistics
+        */
+        void logStatistics();
+
+    private:
+        // a held notification
+        typedef struct {
+            DynamicResource    *resource;
+            uint8_t            *data;
+            int                 length;
+            int                 size;           // allocated bytes (reused across windows)
+            uint32_t            held_us;        // arrival of the first notification in this window
+        } Pending;
+
+        Logger            *m_logger;
+        uint32_t           m_window_ms;
+        Pending           *m_pending;
+        int                m_depth;
+        int                m_count;
+        bool               m_armed;
+        Statistics         m_stats;
+        Mutex              m_mutex;
+        Timeout            m_timeout;
+
+        void               expired();
+        static void        flush_work(void *coalescer);
+        Logger            *logger();
+};
+
+#endif // __NOTIFICATION_COALESCER_H__
@@ -0,0 +1,127 @@
+/**
+ * @file    NotificationStore.h
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NOTIFICATION_STORE_H__
+#define __NOTIFICATION_STORE_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+// mbed support
+#include "mbed.h"
+#include "rtos.h"
+
+// record header: [length:16][name length:8][reserved:8][timestamp:64] (little endian)
+#define NOTIFICATION_RECORD_HEADER_LENGTH   12
+
+/** NotificationStore is a bounded FIFO of timestamped notifications (resource name + payload) recorded while the endpoint
+    is not registered. When full, the oldest records are dropped. Backends provide the byte storage (see RamNotificationStore
+    and FileNotificationStore)
+ */
+class NotificationStore {
+    public:
+        /**
+        Default constructor
+        @param capacity input bytes of record storage
+        */
+        NotificationStore(uint32_t capacity);
+
+        /**
+        Destructor
+        */
+        virtual ~NotificationStore();
+
+        /**
+        Open the store (restores any persisted records)
+        @return true - ready, false - the backing storage is unavailable
+        */
+        virtual bool open();
+
+        /**
+        Append a notification (drops the oldest records if needed)
+        @param name input the resource full name (i.e. "3303/0/5700")
+        @param timestamp_ms input the time of the notification (see now())
+        @param data input the payload
+        @param data_length input the payload length
+        @return true - recorded, false - too large, storage failure or ISR context
+        */
+        bool push(const char *name,uint64_t timestamp_ms,const uint8_t *data,int data_length);
+
+        /**
+        Remove the oldest notification
+        @param name output the resource full name (NULL terminated, truncated to name_length)
+        @param name_length input the size of the name buffer
+        @param timestamp_ms output the time of the notification
+        @param data output the payload (truncated to data_length)
+        @param data_length input the size of the payload buffer
+        @return the payload length (-1 - empty)
+        */
+        int shift(char *name,int name_length,uint64_t &timestamp_ms,uint8_t *data,int data_length);
+
+        /**
+        Discard all notifications
+        */
+        void clear();
+
+        /**
+        Get the number of stored notifications
+        */
+        int count();
+
+        /**
+        Get the number of notifications dropped because the store was full
+        */
+        uint32_t dropped();
+
+        /**
+        Get the record storage capacity (bytes)
+        */
+        uint32_t capacity() { return this->m_capacity; }
+
+        /**
+        Current time for notification timestamps: ms since the epoch if the RTC has been set, otherwise ms since boot
+        */
+        static uint64_t now();
+
+    protected:
+        // backend storage (offsets are within [0,capacity))
+        virtual bool readAt(uint32_t offset,uint8_t *buffer,uint32_t length) = 0;
+        virtual bool writeAt(uint32_t offset,const uint8_t *buffer,uint32_t length) = 0;
+
+        // persist the ring state (backends that survive a reboot override)
+        virtual bool saveState() { return true; }
+
+        uint32_t            m_capacity;
+        uint32_t            m_head;             // next write offset
+        uint32_t            m_tail;             // oldest record offset
+        uint32_t            m_used;             // bytes in use
+        uint32_t            m_count;            // records stored
+        uint32_t            m_dropped;          // records dropped when full
+        Mutex               m_mutex;
+
+    private:
+        bool                ringRead(uint32_t offset,uint8_t *buffer,uint32_t length);
+        bool                ringWrite(uint32_t offset,const uint8_t *buffer,uint32_t length);
+        bool                dropOldest();
+};
+
+#endif // __NOTIFICATION_STORE_H__
@@ -0,0 +1,101 @@
+/**
+ * @file    ObjectInstanceIndex.h
+ * @brief   mbed CoAP Endpoint Object/Resource identifier index for the ObjectInstanceManager (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OBJECT_INSTANCE_INDEX_H__
+#define __OBJECT_INSTANCE_INDEX_H__
+
+// shared identifiers
+#include "mbed-connector-interface/IdentifierTable.h"
+
+/** ObjectInstanceIndex maps an (Object ID, Resource ID) identifier pair to an integer (open addressed hash, O(1) lookup, grows as needed)
+ */
+class ObjectInstanceIndex {
+    public:
+        /**
+        Default constructor
+        */
+        ObjectInstanceIndex();
+
+        /**
+        Copy constructor
+        @param index input the ObjectInstanceIndex that is to be deep copied
+        */
+        ObjectInstanceIndex(const ObjectInstanceIndex &index);
+
+        /**
+        Assignment operator
+        @param index input the ObjectInstanceIndex that is to be deep copied
+        @return this ObjectInstanceIndex
+        */
+        ObjectInstanceIndex &operator=(ObjectInstanceIndex index);
+
+        /**
+        Destructor
+        */
+        virtual ~ObjectInstanceIndex();
+
+        /**
+        Lookup the value stored for a given identifier pair
+        @param obj_id input the Object ID handle
+        @param res_id input the Resource ID handle (IDENTIFIER_INVALID for the object itself)
+        @return the stored value or -1 if not indexed
+        */
+        int lookup(IdentifierHandle obj_id,IdentifierHandle res_id);
+
+        /**
+        Store (or replace) the value for a given identifier pair
+        @param obj_id input the Object ID handle
+        @param res_id input the Resource ID handle (IDENTIFIER_INVALID for the object itself)
+        @param value input the value to store (>= 0)
+        @return true - stored, false - unable to allocate
+        */
+        bool set(IdentifierHandle obj_id,IdentifierHandle res_id,int value);
+
+        /**
+        Get the number of indexed pairs
+        @return the number of indexed pairs
+        */
+        int size() { return this->m_size; }
+
+        /**
+        Clear the index
+        */
+        void clear();
+
+    private:
+        typedef struct {
+            IdentifierHandle obj_id;                // IDENTIFIER_INVALID marks an empty slot
+            IdentifierHandle res_id;
+            int              value;
+        } Entry;
+
+        Entry            *m_entries;
+        int               m_capacity;       // always a power of 2
+        int               m_size;
+
+        int               slot(IdentifierHandle obj_id,IdentifierHandle res_id);
+        Entry            *find(IdentifierHandle obj_id,IdentifierHandle res_id);
+        void              swap(ObjectInstanceIndex &index);
+        bool              grow();
+};
+
+#endif // __OBJECT_INSTANCE_INDEX_H__
@@ -29,6 +29,9 @@
 // Named Pointer List 
 #include "mbed-connector-interface/NamedPointer.h"
 
+// Object/Resource identifier index
+#include "mbed-connector-interface/ObjectInstanceIndex.h"
+
 // Resources list
 #include <vector>
 typedef vector<NamedPointer> NamedPointerList;
@@ -62,6 +65,16 @@ class ObjectInstanceManager {
         @param observable input whether this Resource is observable or not
         */
         void *createDynamicResourceInstance(char *objID,char *resID,char *resName,int resType,bool observable);
+
+        /**
+        Create DynamicResourceInstance (identifier handles)
+        @param objID input the Object ID handle to parent this new resource instance under 
+        @param resID input the Resource ID handle for this resource
+        @param resName input the Resource Name 
+        @param resType input the type of Resource (cast from Resource::ResourceType)
+        @param observable input whether this Resource is observable or not
+        */
+        void *createDynamicResourceInstance(IdentifierHandle objID,IdentifierHandle resID,const char *resName,int resType,bool observable);
         
         /**
         Create StaticResourceInstance
@@ -72,11 +85,22 @@ class ObjectInstanceManager {
         @param observable input whether this Resource is observable or not
         */
         void *createStaticResourceInstance(char *objID,char *resID,char *resName,int resType,void *data,int data_length);
+
+        /**
+        Create StaticResourceInstance (identifier handles)
+        @param objID input the Object ID handle to parent this new resource instance under 
+        @param resID input the Resource ID handle for this resource
+        @param resName input the Resource Name 
+        @param resType input the type of Resource (cast from Resource::ResourceType)
+        @param data input the static value
+        @param data_length input the length of the static value
+        */
+        void *createStaticResourceInstance(IdentifierHandle objID,IdentifierHandle resID,const char *resName,int resType,void *data,int data_length);
         
         /**
-        Get our Object List
+        Get our Object List (no copy is made... valid until the next resource instance is created)
         */
-        NamedPointerList getObjectList();
+        const NamedPointerList &getObjectList();
         
         /** 
         Get the instance number of the just-created ResourceInstance
@@ -88,14 +112,12 @@ class ObjectInstanceManager {
         void            *m_ep;
         NamedPointerList m_object_list;
         int              m_instance_number;
+        ObjectInstanceIndex m_index;        // (objID,INVALID) -> m_object_list position, (objID,resID) -> latest instance number
         
     private:
         // Generic Static and Dynamic Resource Instances/Objects
-        void *getOrCreateInstance(char *objID,char *resID);
-        NamedPointer *getOrCreateObject(char *objID);
-                
-        // Underlying lookup support
-        NamedPointer *getNamedPointer(const char *id,NamedPointerList *list);
+        void *getOrCreateInstance(IdentifierHandle objID,IdentifierHandle resID);
+        int getOrCreateObject(IdentifierHandle objID);
         
         // Logger
         Logger *logger();
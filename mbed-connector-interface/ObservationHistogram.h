@@ -0,0 +1,111 @@
+/**
+ * @file    ObservationHistogram.h
+ * @brief   mbed CoAP Endpoint observation timing histogram (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OBSERVATION_HISTOGRAM_H__
+#define __OBSERVATION_HISTOGRAM_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+// mbed support
+#include "mbed.h"
+
+// sub-buckets per power of two and the number of buckets (values of 2^OBSERVATION_HISTOGRAM_RANGE_BITS or more share the last bucket)
+#define OBSERVATION_HISTOGRAM_SUB_BUCKETS   (1 << OBSERVATION_HISTOGRAM_SUB_BUCKET_BITS)
+#define OBSERVATION_HISTOGRAM_BUCKETS       ((OBSERVATION_HISTOGRAM_SUB_BUCKETS * (OBSERVATION_HISTOGRAM_RANGE_BITS - OBSERVATION_HISTOGRAM_SUB_BUCKET_BITS + 1)) + 1)
+
+/** ObservationHistogram is a fixed size log-linear histogram of 32 bit samples: each power of two is split into
+    OBSERVATION_HISTOGRAM_SUB_BUCKETS linear buckets, so the relative error of a reported percentile is bounded.
+    Recording is O(1) and allocation free (one writer; readers get a best effort snapshot)
+ */
+class ObservationHistogram {
+    public:
+        /**
+        Default constructor
+        */
+        ObservationHistogram();
+
+        /**
+        Record a sample
+        @param value input the sample
+        */
+        void record(uint32_t value);
+
+        /**
+        Discard all samples
+        */
+        void reset();
+
+        /**
+        Get the number of samples recorded
+        */
+        uint32_t count() { return this->m_count; }
+
+        /**
+        Get the smallest sample recorded (0 if none)
+        */
+        uint32_t min() { return (this->m_count > 0) ? this->m_min : 0; }
+
+        /**
+        Get the largest sample recorded
+        */
+        uint32_t max() { return this->m_max; }
+
+        /**
+        Get the mean of the samples recorded
+        */
+        uint32_t mean();
+
+        /**
+        Get a percentile
+        @param percent input the percentile (0-100)
+        @return the upper bound of the bucket holding the percentile (0 if no samples)
+        */
+        uint32_t percentile(int percent);
+
+        /**
+        Format a summary ("n:<count> p50:<p50> p90:<p90> p99:<p99> max:<max>")
+        @param buffer output the summary (NULL terminated)
+        @param length input the size of the buffer
+        @return the summary length
+        */
+        int format(char *buffer,int length);
+
+        /**
+        Get the bucket for a given value
+        */
+        static int bucketOf(uint32_t value);
+
+        /**
+        Get the largest value held by a given bucket
+        */
+        static uint32_t bucketUpperBound(int bucket);
+
+    private:
+        uint16_t        m_buckets[OBSERVATION_HISTOGRAM_BUCKETS];
+        uint32_t        m_count;
+        uint32_t        m_min;
+        uint32_t        m_max;
+        uint64_t        m_sum;
+};
+
+#endif // __OBSERVATION_HISTOGRAM_H__
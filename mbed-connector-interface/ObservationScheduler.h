@@ -0,0 +1,139 @@
+/**
+ * @file    ObservationScheduler.h
+ * @brief   mbed CoAP DynamicResource shared observation scheduler (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OBSERVATION_SCHEDULER_H__
+#define __OBSERVATION_SCHEDULER_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+#ifdef CONNECTOR_USING_SCHEDULER
+
+// mbed support
+#include "mbed.h"
+#include "rtos.h"
+
+// Logger support
+#include "mbed-connector-interface/Logger.h"
+
+// forward reference
+class ScheduledResourceObserver;
+
+/** ObservationScheduler services every ScheduledResourceObserver from a single thread using a min-heap of deadlines.
+    Observers sharing a period are given deterministic phase offsets (bit-reversal order) so that they are spread across
+    the period instead of waking together.
+ */
+class ObservationScheduler {
+    public:
+        // Scheduling statistics
+        typedef struct {
+            uint32_t    observations;           // observations made
+            uint32_t    ticks;                  // OBSERVATION_SCHEDULER_TICK_WINDOW_MS windows in which observations were made
+            uint32_t    peak_per_tick;          // most observations made in one window
+        } Statistics;
+
+        /**
+        Get the shared scheduler instance (created and started on first use)
+        */
+        static ObservationScheduler *instance();
+
+        /**
+        Destructor
+        */
+        virtual ~ObservationScheduler();
+
+        /**
+        Schedule an observer (first observation at its phase slot, within one period from now)
+        @param observer input the observer to schedule
+        @return true - scheduled, false - otherwise
+        */
+        bool add(ScheduledResourceObserver *observer);
+
+        /**
+        Unschedule an observer
+        @param observer input the observer to unschedule
+        */
+        void remove(ScheduledResourceObserver *observer);
+
+        /**
+        Get the number of scheduled observers
+        */
+        int size();
+
+        /**
+        Get a snapshot of the statistics
+        */
+        Statistics getStatistics();
+
+        /**
+        Reset the statistics
+        */
+        void resetStatistics();
+
+        /**
+        Log the statistics
+        @param logger input the logger to use
+        */
+        void logStatistics(Logger *logger);
+
+    private:
+        // phase assignment state for observers sharing a period
+        typedef struct {
+            uint32_t    period_ms;
+            uint64_t    anchor_ms;              // phase zero for this period
+            uint32_t    next_slot;              // slots are handed out in bit-reversal order
+        } PeriodGroup;
+
+        ScheduledResourceObserver **m_heap;
+        int                         m_size;
+        int                         m_capacity;
+        Mutex                       m_mutex;
+        EventFlags                  m_flags;
+        Thread                      m_thread;
+        ScheduledResourceObserver  *m_in_flight;            // observer whose observation_task() is running (outside of the lock)
+        bool                        m_in_flight_removed;    // remove() was called for it while in flight... do not reschedule
+        int                         m_in_flight_waiters;    // remove() callers waiting for it to complete
+        Semaphore                   m_in_flight_done;
+        volatile bool               m_stop;
+        PeriodGroup                *m_groups;
+        int                         m_num_groups;
+        int                         m_groups_capacity;
+        Statistics                  m_stats;
+        uint64_t                    m_tick_deadline;        // first deadline of the current tick window
+        uint32_t                    m_tick_count;
+
+        // constructed via instance()
+        ObservationScheduler();
+
+        void    scheduler_task();
+        uint64_t firstDeadline(uint32_t period_ms,uint64_t now);
+        static uint32_t phaseOffset(uint32_t slot,uint32_t period_ms);
+        bool    push(ScheduledResourceObserver *observer);
+        void    removeAt(int index);
+        void    siftUp(int index);
+        void    siftDown(int index);
+        void    swap(int a,int b);
+};
+
+#endif // CONNECTOR_USING_SCHEDULER
+
+#endif // __OBSERVATION_SCHEDULER_H__
@@ -0,0 +1,55 @@
+/**
+ * @file    ObservationTimingResource.h
+ * @brief   mbed CoAP Endpoint observation timing diagnostic resource (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __OBSERVATION_TIMING_RESOURCE_H__
+#define __OBSERVATION_TIMING_RESOURCE_H__
+
+// Base class
+#include "mbed-connector-interface/DynamicResource.h"
+
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+
+/** ObservationTimingResource is a diagnostic (GET) resource reporting the observation timing histograms of every observed
+    dynamic resource on the endpoint: one line per resource "<name> late_ms <summary> get_us <summary>"
+    (requires CONNECTOR_OBSERVATION_TIMING)
+ */
+class ObservationTimingResource : public DynamicResource
+{
+public:
+    /**
+     * Default constructor
+     * @param logger input logger instance for this resource
+     * @param obj_name input the object name
+     * @param res_name input the resource name
+     * @param observable input the resource is Observable (default: FALSE)
+     */
+    ObservationTimingResource(const Logger *logger,const char *obj_name,const char *res_name,const bool observable = false);
+
+    /**
+     * Get the timing summary of all observed resources
+     */
+    virtual string get();
+};
+
+#endif // CONNECTOR_OBSERVATION_TIMING
+
+#endif // __OBSERVATION_TIMING_RESOURCE_H__
@@ -32,7 +32,17 @@
 // include the mbed connector resource list
 #include "mbed-connector-interface/mbedConnectorInterface.h"
 
+// InboundDispatcher support
+#include "mbed-connector-interface/InboundDispatcher.h"
+
+// NotificationStore support
+#include "mbed-connector-interface/NotificationStore.h"
+
+// NotificationCoalescer support
+#include "mbed-connector-interface/NotificationCoalescer.h"
+
 // include the resource observer includes here so that they are not required in main.cpp
+#include "mbed-connector-interface/ScheduledResourceObserver.h"
 #include "mbed-connector-interface/EventQueueResourceObserver.h"
 #include "mbed-connector-interface/ThreadedResourceObserver.h"
 #include "mbed-connector-interface/TickerResourceObserver.h"
@@ -208,6 +218,29 @@ public:
     */
     int getClientKeySize();
     
+    /**
+    Get the InboundDispatcher queue depth
+    @return the queue depth (0 - inbound requests are processed in the mbed-client callback context)
+    */
+    int getInboundDispatchDepth();
+    
+    /**
+    Get the InboundDispatcher overflow policy
+    */
+    InboundDispatcher::OverflowPolicy getInboundDispatchOverflowPolicy();
+    
+    /**
+    Get the NotificationStore (offline store-and-forward of notifications)
+    @return the store or NULL if notifications made while unregistered are discarded
+    */
+    NotificationStore *getNotificationStore();
+    
+    /**
+    Get the notification coalescing window
+    @return the window in ms (0 - notifications are sent immediately)
+    */
+    uint32_t getNotificationCoalesceWindow();
+    
     /**
     Get Our Endpoint
     */
@@ -243,6 +276,16 @@ protected:
     // CoAP behavior adjustments
     bool                		 	m_enable_immediate_observation;
     bool                 		 	m_enable_get_obs_control;
+    
+    // Inbound request dispatching
+    int								m_inbound_dispatch_depth;
+    InboundDispatcher::OverflowPolicy m_inbound_dispatch_policy;
+
+    // Offline notification store
+    NotificationStore              *m_notification_store;
+
+    // Notification coalescing
+    uint32_t                        m_notification_coalesce_window_ms;
 
     // Endpoint Resources
     void						   *m_device_resources_object;
@@ -201,6 +201,29 @@ public:
     */
     OptionsBuilder &setClientKey(uint8_t *key,int key_size);
     
+    /**
+    Dispatch inbound PUT/POST/DELETE requests from a worker thread instead of the mbed-client callback context
+    @param depth input the maximum number of queued requests (0 - disable)
+    @param policy input the overflow policy when the queue is full
+    */
+    OptionsBuilder &setInboundDispatcher(int depth,InboundDispatcher::OverflowPolicy policy = InboundDispatcher::PROCESS_INLINE);
+    
+#if !defined(CONNECTOR_USING_TICKER)
+    // not available with CONNECTOR_USING_TICKER: Ticker observers notify from ISR context, where the store and coalescer cannot lock or allocate
+
+    /**
+    Record notifications made while unregistered and replay them (in order, rate limited) once registered
+    @param store input the store (i.e. RamNotificationStore or FileNotificationStore) or NULL to disable
+    */
+    OptionsBuilder &setNotificationStore(NotificationStore *store);
+    
+    /**
+    Hold notifications for a short window and send those from all resources together (fewer, larger uplink bursts)
+    @param window_ms input the coalescing window in ms (0 - disable)
+    */
+    OptionsBuilder &setNotificationCoalescing(uint32_t window_ms);
+#endif
+    
     /**
     Build our our immutable self
     */
@@ -0,0 +1,58 @@
+/**
+ * @file    RamNotificationStore.h
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue (RAM backend) (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RAM_NOTIFICATION_STORE_H__
+#define __RAM_NOTIFICATION_STORE_H__
+
+// Base class
+#include "mbed-connector-interface/NotificationStore.h"
+
+/** RamNotificationStore keeps recorded notifications in a heap buffer (lost on reset)
+ */
+class RamNotificationStore : public NotificationStore {
+    public:
+        /**
+        Default constructor
+        @param capacity input bytes of record storage
+        */
+        RamNotificationStore(uint32_t capacity = NOTIFICATION_STORE_RAM_LENGTH);
+
+        /**
+        Destructor
+        */
+        virtual ~RamNotificationStore();
+
+        /**
+        Open the store (allocates the buffer)
+        @return true - ready, false - unable to allocate
+        */
+        virtual bool open();
+
+    protected:
+        virtual bool readAt(uint32_t offset,uint8_t *buffer,uint32_t length);
+        virtual bool writeAt(uint32_t offset,const uint8_t *buffer,uint32_t length);
+
+    private:
+        uint8_t            *m_buffer;
+};
+
+#endif // __RAM_NOTIFICATION_STORE_H__
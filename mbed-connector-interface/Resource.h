@@ -26,6 +26,9 @@
 // logging facility
 #include "mbed-connector-interface/Logger.h"
 
+// shared identifiers
+#include "mbed-connector-interface/IdentifierTable.h"
+
 // mbed-client support
 #include "mbed-client/m2minterfacefactory.h"
 #include "mbed-client/m2minterfaceobserver.h"
@@ -63,11 +66,12 @@ public:
     */
     Resource(const Logger *logger,const string obj_name,const string res_name,InnerType value)  {
         this->init(logger);
-        this->m_obj_name = obj_name;
-        this->m_res_name = res_name;
+        this->m_obj_id = IdentifierTable::instance()->intern(obj_name.c_str());
+        this->m_res_id = IdentifierTable::instance()->intern(res_name.c_str());
         this->m_value = value;
         this->m_implements_observation = false;
         this->m_instance_number = 0;
+        this->buildFullName();
     }
 
     /**
@@ -77,11 +81,12 @@ public:
     Resource(const Resource<InnerType> &resource) {
         this->init(resource.m_logger);
         this->m_endpoint = resource.m_endpoint;
-        this->m_obj_name = resource.m_obj_name;
-        this->m_res_name = resource.m_res_name;
+        this->m_obj_id = resource.m_obj_id;
+        this->m_res_id = resource.m_res_id;
         this->m_value = resource.m_value;
         this->m_implements_observation = resource.m_implements_observation;
         this->m_instance_number = resource.m_instance_number;
+        this->m_full_name = resource.m_full_name;
     }
 
     /**
@@ -94,27 +99,40 @@ public:
     Get the Object name
     @return the name of the object
     */
-    string getObjName() {
-        return this->m_obj_name;
+    const string &getObjName() {
+        return IdentifierTable::instance()->name(this->m_obj_id);
     }
     
     /**
     Get the Resource name
     @return the name of the resource
     */
-    string getResName() {
-        return this->m_res_name;
+    const string &getResName() {
+        return IdentifierTable::instance()->name(this->m_res_id);
+    }
+
+    /**
+    Get the Object identifier handle
+    @return the (shared) identifier handle of the object
+    */
+    IdentifierHandle getObjId() {
+        return this->m_obj_id;
+    }
+
+    /**
+    Get the Resource identifier handle
+    @return the (shared) identifier handle of the resource
+    */
+    IdentifierHandle getResId() {
+        return this->m_res_id;
     }
     
     /**
-    Get the Full  name
+    Get the Full  name (object/instance/resource path, rebuilt only when the instance number changes)
     @return the name of the object
     */
-    string getFullName() {
-        char buf[5];
-        memset(buf,0,5);
-        sprintf(buf,"/%d/",this->m_instance_number);
-        return this->m_obj_name + buf + this->m_res_name;
+    const string &getFullName() {
+        return this->m_full_name;
     }
 
     /**
@@ -179,15 +197,20 @@ public:
     Set our Instance Number
     @param instance_number input our designated instance number
     */
-    void setInstanceNumber(int instance_number) { this->m_instance_number = instance_number; }
+    void setInstanceNumber(int instance_number) {
+        if (this->m_instance_number != instance_number || this->m_full_name.empty()) {
+            this->m_instance_number = instance_number;
+            this->buildFullName();
+        }
+    }
 
 protected:
     // initialize internals to Resource
     void init(const Logger *logger) {
         this->m_logger = (Logger *)logger;
         this->m_endpoint = NULL;
-        this->m_obj_name = "";
-        this->m_res_name = "";
+        this->m_obj_id = IDENTIFIER_INVALID;
+        this->m_res_id = IDENTIFIER_INVALID;
         this->m_value = "";
         this->m_instance_number = 0;
     }
@@ -197,14 +220,29 @@ protected:
         return this->m_options;
     }
 
+    // (re)build our cached full name
+    void buildFullName() {
+        char obj_buf[IDENTIFIER_MAX_DIGITS+2];
+        char res_buf[IDENTIFIER_MAX_DIGITS+2];
+        char buf[16];
+        const char *obj_name = IdentifierTable::instance()->toString(this->m_obj_id,obj_buf,sizeof(obj_buf));
+        const char *res_name = IdentifierTable::instance()->toString(this->m_res_id,res_buf,sizeof(res_buf));
+        snprintf(buf,sizeof(buf),"/%d/",this->m_instance_number);
+        this->m_full_name.reserve(strlen(obj_name) + strlen(buf) + strlen(res_name));
+        this->m_full_name = obj_name;
+        this->m_full_name += buf;
+        this->m_full_name += res_name;
+    }
+
     Logger         *m_logger;
     void           *m_endpoint;
-    string          m_obj_name;
-    string          m_res_name;
+    IdentifierHandle m_obj_id;
+    IdentifierHandle m_res_id;
     InnerType       m_value;
     bool            m_implements_observation;
     void           *m_options;
     int             m_instance_number;
+    string          m_full_name;
 };
 
 #endif // __RESOURCE_H__
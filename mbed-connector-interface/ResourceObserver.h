@@ -26,6 +26,11 @@
 // DynamicResource
 #include "mbed-connector-interface/DynamicResource.h"
 
+// Timing histogram support
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+#include "mbed-connector-interface/ObservationHistogram.h"
+#endif
+
 class ResourceObserver {
     public:
         /**
@@ -70,15 +75,52 @@ class ResourceObserver {
         */
         virtual void halt();
 
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+        /**
+        get the histogram of observation lateness (actual - scheduled observation time, ms)
+        */
+        ObservationHistogram *getLatenessHistogram() { return &this->m_lateness; }
+
+        /**
+        get the histogram of the resource's get() duration (us)
+        */
+        ObservationHistogram *getGetTimeHistogram() { return &this->m_get_time; }
+
+        /**
+        record the duration of the resource's get() (called from DynamicResource::observe())
+        @param get_us input the get() duration (us)
+        */
+        void recordGetTime(uint32_t get_us) { this->m_get_time.record(get_us); }
+
+        /**
+        reset the timing histograms
+        */
+        void resetTimings();
+
+        /**
+        log the timing histograms
+        */
+        void logTimings();
+#endif
+
     protected:
         DynamicResource *getResource();
         void             setObserving(bool observing);
         Logger          *logger();
 
+        // observe our resource (if observing), recording its lateness against the scheduled time (ms, Kernel::get_ms_count() timebase)
+        // when CONNECTOR_OBSERVATION_TIMING is enabled (0 - periodic mechanism: the expected time is tracked here from the first observation)
+        void             observeResource(uint64_t scheduled_ms);
+
     private:
-        DynamicResource *m_resource;
-        bool             m_is_observing;
-        int              m_sleep_time;
+        DynamicResource     *m_resource;
+        bool                 m_is_observing;
+        int                  m_sleep_time;
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+        uint64_t             m_expected_ms;
+        ObservationHistogram m_lateness;
+        ObservationHistogram m_get_time;
+#endif
 };
 
 #endif // __RESOURCE_OBSERVER_H__
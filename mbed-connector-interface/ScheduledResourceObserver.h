@@ -0,0 +1,83 @@
+/**
+ * @file    ScheduledResourceObserver.h
+ * @brief   mbed CoAP DynamicResource shared scheduler-based observer (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SCHEDULED_RESOURCE_OBSERVER_H__
+#define __SCHEDULED_RESOURCE_OBSERVER_H__
+
+// mbedConnectorInterface configuration
+#include "mbed-connector-interface/mbedConnectorInterface.h"
+
+#ifdef CONNECTOR_USING_SCHEDULER
+
+// mbed support
+#include "mbed.h"
+
+// Base class support
+#include "mbed-connector-interface/ResourceObserver.h"
+
+// Shared scheduler support
+#include "mbed-connector-interface/ObservationScheduler.h"
+
+class ScheduledResourceObserver : public ResourceObserver {
+    public:
+        /**
+        Default Constructor
+        @param resource input the resource to observe
+        @param sleep_time input the observation period (in ms)
+        */
+        ScheduledResourceObserver(DynamicResource *resource,int sleep_time = DEFAULT_OBS_PERIOD);
+
+        /**
+        Destructor
+        */
+        virtual ~ScheduledResourceObserver();
+
+        /**
+        begin the observation
+        */
+        virtual void beginObservation();
+
+        /**
+        stop the observation
+        */
+        virtual void stopObservation();
+
+        /**
+        observation task method (invoked from the shared scheduler thread)
+        */
+        void observation_task();
+
+        /**
+        halt the underlying observer mechanism
+        */
+        virtual void halt();
+
+    private:
+        friend class ObservationScheduler;
+
+        uint64_t m_deadline;        // next observation time (ms, Kernel::get_ms_count() timebase)
+        int      m_heap_index;      // our position in the scheduler heap (-1 if not scheduled)
+};
+
+#endif // CONNECTOR_USING_SCHEDULER
+
+#endif // __SCHEDULED_RESOURCE_OBSERVER_H__
@@ -0,0 +1,131 @@
+/**
+ * @file    StartupTimer.h
+ * @brief   mbed CoAP Endpoint startup phase timer (header)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __STARTUP_TIMER_H__
+#define __STARTUP_TIMER_H__
+
+// Logger support
+#include "mbed-connector-interface/Logger.h"
+
+/** StartupTimer records when each endpoint startup phase began and completed (ms since the endpoint instance was created)
+ */
+class StartupTimer {
+    public:
+        /**
+        Startup phases (in the order they normally occur)
+        */
+        typedef enum {
+            PHASE_NETWORK = 0,                  // net_plumb_network(): network interface up
+            PHASE_PLATFORM,                     // storage and platform initialization
+            PHASE_PROVISIONING,                 // FCC init and device configuration verification
+            PHASE_BIND_DEVICE_MANAGER,          // device management objects/resources bound
+            PHASE_BIND_STATIC,                  // static resources bound
+            PHASE_BIND_DYNAMIC,                 // dynamic resources bound
+            PHASE_REGISTRATION,                 // registration sent until on_registered()
+            PHASE_COUNT
+        } StartupPhase;
+
+        /**
+        Default constructor (the timer's origin is now)
+        */
+        StartupTimer();
+
+        /**
+        Copy constructor
+        @param timer input the StartupTimer that is to be deep copied
+        */
+        StartupTimer(const StartupTimer &timer);
+
+        /**
+        Assignment operator
+        @param timer input the StartupTimer that is to be deep copied
+        */
+        StartupTimer &operator=(const StartupTimer &timer);
+
+        /**
+        Destructor
+        */
+        virtual ~StartupTimer();
+
+        /**
+        Mark the beginning of a phase
+        @param phase input the StartupPhase
+        */
+        void begin(int phase);
+
+        /**
+        Mark the completion of a phase
+        @param phase input the StartupPhase
+        @return the duration of the phase in ms
+        */
+        uint32_t end(int phase);
+
+        /**
+        Determine whether a phase has completed
+        @param phase input the StartupPhase
+        @return true - completed, false - otherwise
+        */
+        bool isComplete(int phase);
+
+        /**
+        Get the duration of a completed phase
+        @param phase input the StartupPhase
+        @return the duration in ms (0 if not completed)
+        */
+        uint32_t duration(int phase);
+
+        /**
+        Get when a completed phase finished
+        @param phase input the StartupPhase
+        @return ms since the timer's origin (0 if not completed)
+        */
+        uint32_t completedAt(int phase);
+
+        /**
+        Get the time since the timer's origin
+        @return ms since the timer's origin
+        */
+        uint32_t elapsed();
+
+        /**
+        Get the name of a phase
+        @param phase input the StartupPhase
+        @return the phase name
+        */
+        static const char *name(int phase);
+
+        /**
+        Log a summary of the completed phases
+        @param logger input the logger instance
+        */
+        void logTimings(Logger *logger);
+
+    private:
+        uint64_t          m_origin;
+        uint32_t          m_begin[PHASE_COUNT];
+        uint32_t          m_end[PHASE_COUNT];
+        uint8_t           m_complete[PHASE_COUNT];
+
+        uint64_t          now();
+};
+
+#endif // __STARTUP_TIMER_H__
@@ -45,8 +45,7 @@ class TickerResourceObserver : public ResourceObserver {
         /**
         Default Constructor
         @param resource input the resource to observe
-        @param timer_id input the id for our timer (can be index value of each resource that is observed...)
-        @param sleep_time input the time for the observation tasklet to sleep (in whole seconds...)
+        @param sleep_time input the observation period (in ms)
         */
         TickerResourceObserver(DynamicResource *resource,int sleep_time = DEFAULT_OBS_PERIOD);
         
@@ -71,9 +70,9 @@ class TickerResourceObserver : public ResourceObserver {
         virtual void stopObservation();
                      
         /**
-        observation task method
+        observation task method (bound to this instance, invoked from the Ticker ISR)
         */
-        static void observation_task(void);
+        void observation_task(void);
         
         /**
         halt the underlying observer mechanism
@@ -81,7 +80,7 @@ class TickerResourceObserver : public ResourceObserver {
         virtual void halt();
     
     private:
-        Ticker m_ticker;
+        Ticker m_ticker;            // every Ticker instance multiplexes onto the single us_ticker
 };
 
 #endif // CONNECTOR_USING_TICKER
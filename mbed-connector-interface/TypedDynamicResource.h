@@ -0,0 +1,240 @@
+/**
+ * @file    TypedDynamicResource.h
+ * @brief   mbed CoAP Endpoint Dynamic Resource class with a native (non-string) value type
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TYPED_DYNAMIC_RESOURCE_H__
+#define __TYPED_DYNAMIC_RESOURCE_H__
+
+// Base Class
+#include "mbed-connector-interface/DynamicResource.h"
+
+// Vector support (opaque values)
+#include <vector>
+
+// largest formatted (text) numeric value
+#define TYPED_RESOURCE_FORMAT_BUFFER_LENGTH 32
+
+/** TypedResourceTraits maps a native value type to its Resource type at compile time (unsupported types fail to compile)
+ */
+template <typename T> struct TypedResourceTraits;
+template <> struct TypedResourceTraits<int>                   { static const int type = DynamicResource::INTEGER; };
+template <> struct TypedResourceTraits<float>                 { static const int type = DynamicResource::FLOAT; };
+template <> struct TypedResourceTraits<bool>                  { static const int type = DynamicResource::BOOLEAN; };
+template <> struct TypedResourceTraits< vector<uint8_t> >     { static const int type = DynamicResource::OPAQUE; };
+
+/** TypedDynamicResource is a DynamicResource that holds a native value (int, float, bool or an opaque byte vector).
+    Values are only serialized when a CoAP payload is needed (observation/notify) and PUT payloads are decoded
+    straight into the native type. Binders override getTyped() and/or putTyped() instead of get()/put().
+ */
+template <typename T> class TypedDynamicResource : public DynamicResource
+{
+public:
+    /**
+    Default constructor
+    @param logger input logger instance for this resource
+    @param obj_name input the Object
+    @param res_name input the Resource URI/Name
+    @param res_type input type for the Resource
+    @param value input initial value for the Resource
+    @param res_mask input the resource enablement mask (GET, PUT, etc...)
+    @param observable input the resource is Observable (default: FALSE)
+    */
+    TypedDynamicResource(const Logger *logger,const char *obj_name,const char *res_name,const char *res_type,const T value,uint8_t res_mask,const bool observable = false) :
+        DynamicResource(logger,obj_name,res_name,res_type,res_mask,observable,(ResourceType)TypedResourceTraits<T>::type) {
+        this->m_typed_value = value;
+    }
+
+    /**
+    Copy constructor
+    @param resource input the TypedDynamicResource that is to be deep copied
+    */
+    TypedDynamicResource(const TypedDynamicResource<T> &resource) : DynamicResource((const DynamicResource &)resource) {
+        this->m_typed_value = resource.m_typed_value;
+    }
+
+    /**
+    Destructor
+    */
+    virtual ~TypedDynamicResource() {
+    }
+
+    /**
+    Native value getter (OPTIONAL: defaults to the last stored value)
+    @returns the native value of the resource
+    */
+    virtual T getTyped() {
+        return this->m_typed_value;
+    }
+
+    /**
+    Native value setter (PUT) (OPTIONAL: defaults to storing the value)
+    @param value input the decoded native value
+    */
+    virtual void putTyped(const T &value) {
+        this->m_typed_value = value;
+    }
+
+    /**
+    Store a new native value and send a notification of it
+    @param value input the new native value
+    @returns 1 - success, 0 - failure
+    */
+    int notifyTyped(const T &value) {
+        char buf[TYPED_RESOURCE_FORMAT_BUFFER_LENGTH];
+        const uint8_t *data = NULL;
+        int data_length = 0;
+        this->m_typed_value = value;
+        this->encode(value,buf,data,data_length);
+        return this->notify(data,data_length);
+    }
+
+    /**
+    Resource value getter (string form: only used at bind time and by legacy callers)
+    @returns string value of the resource
+    */
+    virtual string get() {
+        char buf[TYPED_RESOURCE_FORMAT_BUFFER_LENGTH];
+        const uint8_t *data = NULL;
+        int data_length = 0;
+        T value = this->getTyped();
+        this->encode(value,buf,data,data_length);
+        return string((const char *)data,data_length);
+    }
+
+    /**
+    Resource value setter (string form: only used by legacy callers)
+    @param value input string value of the resource
+    */
+    virtual void put(const string value) {
+        T typed_value;
+        if (this->decode((const uint8_t *)value.c_str(),(int)value.length(),typed_value) == true) {
+            this->m_typed_value = typed_value;
+            this->putTyped(typed_value);
+        }
+    }
+
+    /**
+    observe the resource (formats the native value into a stack buffer, no string conversion)
+    */
+    virtual void observe() {
+        if (this->canObserve() == true) {
+            char buf[TYPED_RESOURCE_FORMAT_BUFFER_LENGTH];
+            const uint8_t *data = NULL;
+            int data_length = 0;
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+            // time getTyped() on its own (as DynamicResource::observe() times get())
+            uint32_t start_us = us_ticker_read();
+            T value = this->getTyped();
+            this->recordGetTime(start_us);
+#else
+            T value = this->getTyped();
+#endif
+            this->encode(value,buf,data,data_length);
+            this->observeValue(data,data_length);
+        }
+    }
+
+protected:
+    // PUT payloads are decoded directly into the native type
+    virtual void putPayload(uint8_t *data,int data_length) {
+        const uint8_t *payload = data;
+        int payload_length = data_length;
+        T typed_value;
+        if (this->getDataWrapper() != NULL) {
+            // unwrap the data...
+            this->getDataWrapper()->unwrap(data,data_length);
+            payload = this->getDataWrapper()->get();
+            payload_length = this->getDataWrapper()->length();
+        }
+        if (this->decode(payload,payload_length,typed_value) == true) {
+            this->m_typed_value = typed_value;
+            this->putTyped(typed_value);
+        }
+        else {
+            LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"TypedDynamicResource: [%s] WARNING unable to decode %d byte PUT payload",this->getFullName().c_str(),payload_length);
+        }
+    }
+
+private:
+    T m_typed_value;
+
+    // encoders (text payloads for numeric types, raw bytes for opaque values... %.9g round trips a float)
+    void encode(const int &value,char *buf,const uint8_t *&data,int &data_length) {
+        data_length = snprintf(buf,TYPED_RESOURCE_FORMAT_BUFFER_LENGTH,"%d",value);
+        if (data_length >= TYPED_RESOURCE_FORMAT_BUFFER_LENGTH) data_length = TYPED_RESOURCE_FORMAT_BUFFER_LENGTH - 1;
+        data = (const uint8_t *)buf;
+    }
+    void encode(const float &value,char *buf,const uint8_t *&data,int &data_length) {
+        data_length = snprintf(buf,TYPED_RESOURCE_FORMAT_BUFFER_LENGTH,"%.9g",(double)value);
+        if (data_length >= TYPED_RESOURCE_FORMAT_BUFFER_LENGTH) data_length = TYPED_RESOURCE_FORMAT_BUFFER_LENGTH - 1;
+        data = (const uint8_t *)buf;
+    }
+    void encode(const bool &value,char *buf,const uint8_t *&data,int &data_length) {
+        buf[0] = value ? '1' : '0';
+        buf[1] = '\0';
+        data_length = 1;
+        data = (const uint8_t *)buf;
+    }
+    void encode(const vector<uint8_t> &value,char * /* buf */,const uint8_t *&data,int &data_length) {
+        data_length = (int)value.size();
+        data = value.empty() ? NULL : &value[0];
+    }
+
+    // decoders
+    bool decode(const uint8_t *data,int data_length,int &value) {
+        return DynamicResource::decodeInteger(data,data_length,value,this->binaryContent());
+    }
+    bool decode(const uint8_t *data,int data_length,float &value) {
+        return DynamicResource::decodeFloat(data,data_length,value,this->binaryContent());
+    }
+    bool decode(const uint8_t *data,int data_length,bool &value) {
+        int length = DynamicResource::textLength(data,data_length);
+        int ivalue = 0;
+        if (length == 4 && strncmp((const char *)data,"true",4) == 0) {
+            value = true;
+            return true;
+        }
+        if (length == 5 && strncmp((const char *)data,"false",5) == 0) {
+            value = false;
+            return true;
+        }
+        if (DynamicResource::decodeInteger(data,data_length,ivalue,this->binaryContent()) == true) {
+            value = (ivalue != 0);
+            return true;
+        }
+        return false;
+    }
+    bool decode(const uint8_t *data,int data_length,vector<uint8_t> &value) {
+        if (data == NULL || data_length < 0) {
+            return false;
+        }
+        value.assign(data,data + data_length);
+        return true;
+    }
+};
+
+// Convenience typedefs
+typedef TypedDynamicResource<int>                   IntegerDynamicResource;
+typedef TypedDynamicResource<float>                 FloatDynamicResource;
+typedef TypedDynamicResource<bool>                  BooleanDynamicResource;
+typedef TypedDynamicResource< vector<uint8_t> >     OpaqueDynamicResource;
+
+#endif // __TYPED_DYNAMIC_RESOURCE_H__
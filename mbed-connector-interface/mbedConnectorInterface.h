@@ -33,12 +33,21 @@
 /************** DEFAULT CONFIGURATION PARAMETERS  ************************/
 
 //
-// ResourceObserver type: EventQueue, Threading, or Ticker (only ONE may be uncommented)
+// ResourceObserver type: Scheduler, EventQueue, Threading, or Ticker (only ONE may be uncommented)
 //
-//#define CONNECTOR_USING_EVENT_QUEUES  1	// currently broken... please do not use
-#define CONNECTOR_USING_THREADS         1	// Threads used
+#define CONNECTOR_USING_SCHEDULER       1	// Single shared scheduler thread services all observers (default)
+//#define CONNECTOR_USING_EVENT_QUEUES  1	// One shared, dispatched EventQueue services all observers
+//#define CONNECTOR_USING_THREADS       1	// One Thread (and stack) per observed resource
 //#define CONNECTOR_USING_TICKER        1	// Tickers - resource's get() method called from within ISR!!! 
 
+// Shared observation scheduler thread stack size (CONNECTOR_USING_SCHEDULER)
+#define OBSERVATION_SCHEDULER_STACK_SIZE	4096
+#define OBSERVATION_SCHEDULER_TICK_WINDOW_MS	10										// observations whose deadlines fall within this window share a tick (statistics)
+
+// Shared EventQueue sizing (CONNECTOR_USING_EVENT_QUEUES)
+#define EVENT_QUEUE_OBSERVER_EVENTS			32											// maximum number of observed resources
+#define EVENT_QUEUE_OBSERVER_STACK_SIZE		4096										// stack size of the EventQueue dispatch thread
+
 // mbedOS5 uses LWIP
 #define MCI_LWIP_INTERFACE                  true
 
@@ -69,8 +78,8 @@
 #define DOMAIN_LENGTH        				128
 #define DEFAULT_DOMAIN              		"domain"
  
-// Main loop iteration wait time (ms)
-#define MAIN_LOOP_WAIT_TIME_MS				1000
+// Main loop work queue (net_post_work())
+#define MAIN_LOOP_WORK_QUEUE_DEPTH			8											// work items that may be pending on the (event driven) main loop
  
 // mbed-client endpoint lifetime
 #define REG_LIFETIME_SEC					100  										// Lifetime of the endpoint in seconds
@@ -83,10 +92,60 @@
 
 // DynamicResource Configuration
 #define MAX_VALUE_BUFFER_LENGTH  			1024                                        // largest "value" a dynamic resource may assume as a string (max CoAP packet length)
+#define LAZY_BIND_STACK_SIZE				4096										// stack size of the background resolver for DynamicResource::setLazyBind() resources (runs get())
+
+// Observation timing histograms (per ResourceObserver: lateness in ms, get() duration in us)
+//#define CONNECTOR_OBSERVATION_TIMING			1											// record the histograms (off by default: ~430 bytes per observed resource)
+#define OBSERVATION_HISTOGRAM_SUB_BUCKET_BITS	2											// 2^n linear buckets per power of two (percentiles within 25%)
+#define OBSERVATION_HISTOGRAM_RANGE_BITS	24											// samples of 2^n or more share one overflow bucket
+
+// ObjectInstanceManager Configuration
+#define OIM_OBJECT_POOL_SIZE				16											// object slots reserved up front (the list still grows past this if needed)
+
+// Network ConnectionManager Configuration
+#define CONNECTION_BACKOFF_INITIAL_MS		1000										// delay after the first failed connect() attempt
+#define CONNECTION_BACKOFF_MAX_MS			60000										// delay doubles after each failure up to this
+#define CONNECTION_BACKOFF_JITTER_PERCENT	25											// up to this percentage of each delay is randomly removed
+#define CONNECTION_MAX_ATTEMPTS				0											// attempts per connection before giving up (0 - unlimited)
+#define CONNECTION_MANAGER_STACK_SIZE		4096										// stack size of the reconnection thread (runs connect() and logs)
+
+// InboundDispatcher Configuration (disabled unless OptionsBuilder::setInboundDispatcher() is called)
+#define DEFAULT_INBOUND_DISPATCH_DEPTH		8											// default number of inbound requests that may be queued
+#define INBOUND_DISPATCH_STACK_SIZE			4096										// stack size of the inbound dispatch worker thread
+
+// NotificationStore Configuration (disabled unless OptionsBuilder::setNotificationStore() is called)
+#define NOTIFICATION_STORE_RAM_LENGTH		4096										// default bytes of record storage for a RamNotificationStore
+#define NOTIFICATION_STORE_FILE_LENGTH		16384										// default bytes of record storage for a FileNotificationStore
+#define NOTIFICATION_STORE_PATH_LENGTH		64											// longest FileNotificationStore path
+#define NOTIFICATION_STORE_NAME_LENGTH		48											// longest resource full name replayed from the store
+#define NOTIFICATION_REPLAY_INTERVAL_MS		200											// delay between replayed batches (rate limit after registration)
+#define NOTIFICATION_REPLAY_BATCH			16											// notifications replayed back to back per interval (must outpace live notifications queued behind the replay)
+#define NOTIFICATION_REPLAY_STACK_SIZE		(LOGGER_BUFFER_LENGTH + 2048)				// stack size of the (low priority) replay thread: one Logger line plus mbed-client headroom (the payload is on the heap)
+
+// NotificationCoalescer Configuration (disabled unless OptionsBuilder::setNotificationCoalescing() is called)
+#define NOTIFICATION_COALESCE_DEPTH			16											// resources that may be held in one coalescing window (others are sent immediately)
 
 // Logger buffer size
 #define LOGGER_BUFFER_LENGTH     		 	1024                                         // largest single print of a given debug line
 
+// Logger compile-time filtering (statements above LOGGER_COMPILE_LEVEL, or not in LOGGER_COMPILE_MODULES, generate no code)
+#if !defined(LOGGER_COMPILE_LEVEL)
+	#if defined(QUIET_LOGGING)
+		#define LOGGER_COMPILE_LEVEL		LOGGER_LEVEL_NONE
+	#else
+		#define LOGGER_COMPILE_LEVEL		LOGGER_LEVEL_DEBUG							// LOGGER_LEVEL_NONE, _ERROR, _WARN, _INFO, _DEBUG or _TRACE
+	#endif
+#endif
+#if !defined(LOGGER_COMPILE_MODULES)
+	#define LOGGER_COMPILE_MODULES			LOGGER_MODULE_ALL							// OR of LOGGER_MODULE_ENDPOINT, _RESOURCE, _OBSERVER, _OIM, _NETWORK
+#endif
+
+// Asynchronous Logger Configuration (disabled unless Logger::startAsync() is called)
+#define LOGGER_ASYNC_RING_LENGTH			4096										// bytes of buffered log records (power of 2, at least 2x LOGGER_BUFFER_LENGTH)
+#define LOGGER_ASYNC_STACK_SIZE				2048										// stack size of the (low priority) log drain thread
+#define LOGGER_BINARY_RECORD_LENGTH			128											// largest binary log record (format address + raw arguments) (Logger::startBinary())
+#define LOGGER_BINARY_STRING_LENGTH			32											// longest %s argument recorded in a binary log record
+
 // WiFi Configuration
 #define WIFI_SSID_LENGTH         			64
 #define WIFI_DEFAULT_SSID       			"changeme"
@@ -28,5 +28,8 @@ extern "C" char *net_get_type(void);
 extern "C" void  net_shutdown_endpoint(void);
 extern "C" void  net_plumb_network(void *p);                                       
 extern "C" void  net_finalize_and_run_endpoint_main_loop(void *p); 
+extern "C" void *net_get_connection_manager(void);                                 // ConnectionManager instance (statistics)
+extern "C" void  net_registration_changed(void);                                   // wake the main loop: registration state changed
+extern "C" bool  net_post_work(void (*work)(void *),void *arg);                    // run work(arg) on the main loop thread (ISR safe, false if the queue is full)
 
 #endif // __MBED_ENDPOINT_NETWORK_IMPL_H__
\ No newline at end of file
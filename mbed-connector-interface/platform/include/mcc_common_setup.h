@@ -32,9 +32,6 @@ typedef void (*main_t)(void);
 //   0 for success, anything else for error
 int mcc_platform_init(void);
 
-// Initialize network connection
-int mcc_platform_init_connection(void);
-
 // Close network connection
 int mcc_platform_close_connection(void);
 
@@ -0,0 +1,244 @@
+/**
+ * @file    ConnectionManager.cpp
+ * @brief   mbed CoAP Endpoint network connection manager with backoff
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ConnectionManager.h"
+
+ // constructor
+ ConnectionManager::ConnectionManager(const Logger *logger,uint32_t initial_backoff_ms,uint32_t max_backoff_ms,uint32_t jitter_percent,uint32_t max_attempts) : m_link_lost(0), m_mutex() {
+     this->m_logger = (Logger *)logger;
+     this->m_net = NULL;
+     this->m_initial_backoff_ms = (initial_backoff_ms > 0) ? initial_backoff_ms : 1;
+     this->m_max_backoff_ms = (max_backoff_ms > this->m_initial_backoff_ms) ? max_backoff_ms : this->m_initial_backoff_ms;
+     this->m_jitter_percent = (jitter_percent > 100) ? 100 : jitter_percent;
+     this->m_max_attempts = max_attempts;
+     this->m_connected = false;
+     this->m_stop = false;
+     this->m_thread = NULL;
+     this->m_attempt = 0;
+     this->m_backoff_ms = 0;
+     this->m_register_backoff_ms = 0;
+     this->m_first_attempt_ms = 0;
+     this->m_random = 0;
+     this->m_link_losses = 0;
+     memset(&this->m_stats,0,sizeof(this->m_stats));
+ }
+
+ // destructor
+ ConnectionManager::~ConnectionManager() {
+     if (this->m_thread != NULL) {
+         // wake the reconnection thread so that it sees the stop request (at most one backoff delay away)
+         this->m_stop = true;
+         this->m_link_lost.release();
+         this->m_thread->join();
+         delete this->m_thread;
+     }
+ }
+
+ // bring the network up (blocking)
+ nsapi_error_t ConnectionManager::connect(NetworkInterface *net) {
+     if (net == NULL) {
+         return NSAPI_ERROR_NO_CONNECTION;
+     }
+     if (this->m_net == NULL) {
+         // link status changes drive reconnection (on our own thread... connect() blocks)
+         this->m_net = net;
+         this->m_thread = new Thread(osPriorityBelowNormal,CONNECTION_MANAGER_STACK_SIZE);
+         if (this->m_thread != NULL && this->m_thread->start(callback(this,&ConnectionManager::reconnect_task)) != osOK) {
+             delete this->m_thread;
+             this->m_thread = NULL;
+         }
+         if (this->m_thread == NULL) {
+             LOG_WARN(this->logger(),LOGGER_MODULE_NETWORK,"ConnectionManager: unable to start the reconnection thread... link loss will not be recovered");
+         }
+         this->m_net->attach(callback(this,&ConnectionManager::status_changed));
+     }
+     return this->connectWithBackoff();
+ }
+
+ // connect, backing off between failed attempts (blocking: initial connection, or the reconnection thread)
+ nsapi_error_t ConnectionManager::connectWithBackoff() {
+     this->m_attempt = 0;
+     this->m_backoff_ms = 0;
+     while (this->attempt(Kernel::get_ms_count()) == false) {
+         if (this->m_max_attempts > 0 && this->m_attempt >= this->m_max_attempts) {
+             LOG_ERROR(this->logger(),LOGGER_MODULE_NETWORK,"ConnectionManager: giving up after %lu attempts (last error: %d)",(unsigned long)this->m_attempt,this->m_stats.last_error);
+             return (nsapi_error_t)this->m_stats.last_error;
+         }
+         if (this->m_stop == true) {
+             return NSAPI_ERROR_NO_CONNECTION;
+         }
+         uint32_t delay_ms = this->nextDelay();
+         LOG_WARN(this->logger(),LOGGER_MODULE_NETWORK,"ConnectionManager: unable to connect (%d)... retrying in %lu ms",this->m_stats.last_error,(unsigned long)delay_ms);
+         ThisThread::sleep_for(delay_ms);
+     }
+     return NSAPI_ERROR_OK;
+ }
+
+ // re-establish the link after each link loss (reconnection thread)
+ void ConnectionManager::reconnect_task() {
+     while (this->m_stop == false) {
+         this->m_link_lost.wait();
+         if (this->m_stop == true || this->m_connected == true) {
+             // stopping, or the network stack restored the link on its own
+             continue;
+         }
+         if (this->connectWithBackoff() == NSAPI_ERROR_OK) {
+             LOG_INFO(this->logger(),LOGGER_MODULE_NETWORK,"ConnectionManager: reconnected (%lu ms)",(unsigned long)this->m_stats.last_connect_ms);
+             if (this->m_link_changed) {
+                 this->m_link_changed();
+             }
+         }
+         // on failure (max attempts) a later link loss restarts reconnection
+     }
+ }
+
+ // link status change callback
+ void ConnectionManager::attach(mbed::Callback<void()> link_changed) {
+     this->m_link_changed = link_changed;
+ }
+
+ // get the connection statistics
+ ConnectionManager::Statistics ConnectionManager::getStatistics() {
+     this->m_mutex.lock();
+     Statistics stats = this->m_stats;
+     this->m_mutex.unlock();
+     stats.link_losses = this->m_link_losses;
+     return stats;
+ }
+
+ // log the connection statistics
+ void ConnectionManager::logStatistics() {
+     Statistics stats = this->getStatistics();
+     uint32_t avg_ms = (stats.connects > 0) ? (uint32_t)(stats.total_connect_ms / stats.connects) : 0;
+     LOG_INFO(this->logger(),LOGGER_MODULE_NETWORK,"ConnectionManager: attempts=%lu failures=%lu connects=%lu link_losses=%lu connect_ms(last/avg/max)=%lu/%lu/%lu",
+              (unsigned long)stats.attempts,(unsigned long)stats.failures,(unsigned long)stats.connects,(unsigned long)stats.link_losses,
+              (unsigned long)stats.last_connect_ms,(unsigned long)avg_ms,(unsigned long)stats.max_connect_ms);
+ }
+
+ // make a single connection attempt
+ bool ConnectionManager::attempt(uint64_t now) {
+     if (this->m_attempt == 0) {
+         this->m_first_attempt_ms = now;
+     }
+     ++this->m_attempt;
+     nsapi_error_t status = this->m_net->connect();
+     bool connected = (status == NSAPI_ERROR_OK || status == NSAPI_ERROR_IS_CONNECTED);
+     this->m_mutex.lock();
+     ++this->m_stats.attempts;
+     this->m_stats.last_error = status;
+     if (connected == true) {
+         uint32_t connect_ms = (uint32_t)(Kernel::get_ms_count() - this->m_first_attempt_ms);
+         this->m_stats.last_connect_ms = connect_ms;
+         this->m_stats.total_connect_ms += connect_ms;
+         if (connect_ms > this->m_stats.max_connect_ms) {
+             this->m_stats.max_connect_ms = connect_ms;
+         }
+         ++this->m_stats.connects;
+     }
+     else {
+         ++this->m_stats.failures;
+     }
+     this->m_mutex.unlock();
+     if (connected == true) {
+         this->m_attempt = 0;
+         this->m_connected = true;
+     }
+     return connected;
+ }
+
+ // next (jittered) delay between connection attempts (connecting thread only)
+ uint32_t ConnectionManager::nextDelay() {
+     this->m_mutex.lock();
+     uint32_t delay_ms = this->backoff(this->m_backoff_ms);
+     this->m_mutex.unlock();
+     return delay_ms;
+ }
+
+ // next (jittered) delay before re-registering
+ uint32_t ConnectionManager::nextRegistrationDelay() {
+     this->m_mutex.lock();
+     uint32_t delay_ms = this->backoff(this->m_register_backoff_ms);
+     this->m_mutex.unlock();
+     return delay_ms;
+ }
+
+ // registered... reset the re-registration backoff
+ void ConnectionManager::registrationSucceeded() {
+     this->m_mutex.lock();
+     this->m_register_backoff_ms = 0;
+     this->m_mutex.unlock();
+ }
+
+ // advance a backoff (doubles after each failure, capped at the max backoff) and jitter it (m_mutex held)
+ uint32_t ConnectionManager::backoff(uint32_t &backoff_ms) {
+     if (backoff_ms == 0) {
+         backoff_ms = this->m_initial_backoff_ms;
+     }
+     else if (backoff_ms < this->m_max_backoff_ms) {
+         backoff_ms = (backoff_ms > (this->m_max_backoff_ms / 2)) ? this->m_max_backoff_ms : (backoff_ms * 2);
+     }
+     uint32_t delay_ms = backoff_ms;
+     uint32_t jitter_ms = (uint32_t)(((uint64_t)delay_ms * this->m_jitter_percent) / 100);
+     if (jitter_ms > 0) {
+         // spread retries from many devices so they do not hit the AP (or the server) in lock step
+         delay_ms -= this->random() % (jitter_ms + 1);
+     }
+     return delay_ms;
+ }
+
+ // xorshift32 (jitter only... not for security, m_mutex held)
+ uint32_t ConnectionManager::random() {
+     if (this->m_random == 0) {
+         // seed on first use (not at construction... static instances are built before the ticker is up)
+         this->m_random = us_ticker_read() | 1;
+     }
+     uint32_t x = this->m_random;
+     x ^= x << 13;
+     x ^= x >> 17;
+     x ^= x << 5;
+     this->m_random = x;
+     return x;
+ }
+
+ // network interface status callback (network stack context: flags, atomics and a semaphore release only)
+ void ConnectionManager::status_changed(nsapi_event_t event,intptr_t status) {
+     if (event == NSAPI_EVENT_CONNECTION_STATUS_CHANGE) {
+         if (status == NSAPI_STATUS_DISCONNECTED && this->m_connected == true) {
+             // only a link we had established counts (failed attempts also report DISCONNECTED)
+             core_util_atomic_incr_u32(&this->m_link_losses,1);
+             this->m_connected = false;
+             this->m_link_lost.release();
+         }
+         else if (status == NSAPI_STATUS_GLOBAL_UP || status == NSAPI_STATUS_LOCAL_UP) {
+             this->m_connected = true;
+         }
+         if (this->m_link_changed) {
+             this->m_link_changed();
+         }
+     }
+ }
+
+ // Logger
+ Logger *ConnectionManager::logger() {
+     return this->m_logger;
+ }
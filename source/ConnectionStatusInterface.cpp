@@ -62,4 +62,12 @@ void ConnectionStatusInterface::bootstrapped(void * /* ep */,void * /* data */)
 void ConnectionStatusInterface::value_updated(void * /* ep */,void * /* data */,int /* type */) {
 }
 
+// Startup phase completed
+void ConnectionStatusInterface::startup_phase_completed(void * /* ep */,int /* phase */,uint32_t /* duration_ms */,uint32_t /* completed_at_ms */) {
+}
+
+// Startup completed
+void ConnectionStatusInterface::startup_completed(void * /* ep */,uint32_t /* total_ms */) {
+}
+
 } // Connector namespace
\ No newline at end of file
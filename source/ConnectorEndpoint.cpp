@@ -132,9 +132,19 @@ Endpoint::Endpoint(const Logger *logger, const Options *options) :
 	this->m_device_manager = NULL;
 	this->m_connected = false;
 	this->m_registered = false;
+	this->m_deregistering = false;
 	this->m_csi = NULL;
 	this->m_oim = NULL;
+	this->m_inbound_dispatcher = NULL;
 	this->m_endpoint_interface = NULL;
+	this->m_lazy_bind_thread = NULL;
+	this->m_notification_store = NULL;
+	this->m_replay_thread = NULL;
+	this->m_replay_signal = NULL;
+	this->m_replay_buffer = NULL;
+	this->m_replaying = false;
+	this->m_replay_stop = false;
+	this->m_coalescer = NULL;
 }
 
 // Copy Constructor
@@ -146,12 +156,45 @@ Endpoint::Endpoint(const Endpoint &ep) {
 	this->m_device_manager = ep.m_device_manager;
 	this->m_connected = ep.m_connected;
 	this->m_registered = ep.m_registered;
+	this->m_deregistering = ep.m_deregistering;
 	this->m_csi = ep.m_csi;
 	this->m_oim = ep.m_oim;
+	this->m_dynamic_resource_index = ep.m_dynamic_resource_index;
+	this->m_inbound_dispatcher = NULL;
+	if (ep.m_inbound_dispatcher != NULL) {
+		// the worker thread is not shared... the copy gets a dispatcher of its own
+		this->m_inbound_dispatcher = new InboundDispatcher(ep.m_logger,ep.m_inbound_dispatcher->getDepth(),ep.m_inbound_dispatcher->getOverflowPolicy());
+		if (this->m_inbound_dispatcher != NULL && this->m_inbound_dispatcher->start() == false) {
+			delete this->m_inbound_dispatcher;
+			this->m_inbound_dispatcher = NULL;
+		}
+	}
+	this->m_startup_timer = ep.m_startup_timer;
+	this->m_lazy_bind_thread = NULL;
+	this->m_notification_store = ep.m_notification_store;
+	this->m_replay_thread = NULL;
+	this->m_replay_signal = NULL;
+	this->m_replay_buffer = NULL;
+	this->m_replaying = false;
+	this->m_replay_stop = false;
+	this->m_coalescer = ep.m_coalescer;
 }
 
 // Destructor
 Endpoint::~Endpoint() {
+	this->joinLazyBindThread();
+	if (this->m_replay_thread != NULL) {
+		// stop the replay (at most one batch interval away) and free it
+		this->m_replay_stop = true;
+		this->m_replay_signal->release();
+		this->m_replay_thread->join();
+		delete this->m_replay_thread;
+		delete this->m_replay_signal;
+		free(this->m_replay_buffer);
+	}
+	if (this->m_inbound_dispatcher != NULL) {
+		delete this->m_inbound_dispatcher;
+	}
 }
 
 // set the device manager
@@ -197,42 +240,49 @@ void Endpoint::createEndpointInterface() {
 // mbedCloudClient: initialize the platform
 bool Endpoint::initializePlatform() {
 	// initialize the underlying platform
-	this->logger()->log("initializePlatform: initializing underlying platform...");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"initializePlatform: initializing underlying platform...");
 	if (utils_init_platform() != true) {
-		this->logger()->log("initializePlatform: ERROR: utils_init_platform() failed!");
+		LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"initializePlatform: ERROR: utils_init_platform() failed!");
 		return false;
 	}
 
 	// DEBUG
-	this->logger()->log("initializePlatform: platform initialized SUCCESS!");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"initializePlatform: platform initialized SUCCESS!");
 	return true;
 }
 
 // mbedCloudClient: initialize provisioning flow
 bool Endpoint::initializeProvisioningFlow() {
-     this->logger()->log("iinitializeProvisioningFlow: initializing provisioning flow...");
+     LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"iinitializeProvisioningFlow: initializing provisioning flow...");
      if (utils_init_provisioning_flow() != true) {
-          this->logger()->log("initializeProvisioningFlow: ERROR utils_init_provisioning_flow() failed");
+          LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"initializeProvisioningFlow: ERROR utils_init_provisioning_flow() failed");
           return false;
      }
 
      // DEBUG
-     this->logger()->log("initializeProvisioningFlow: provisioning flow initialized SUCCESS!");
+     LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"initializeProvisioningFlow: provisioning flow initialized SUCCESS!");
      return true;
 }
 
 // mbedCloudClient: create our interface
 void Endpoint::createCloudEndpointInterface() {
 	if (this->m_endpoint_interface == NULL) {
+		bool provisioning_flow_init = false;
+		this->startupPhaseBegin(StartupTimer::PHASE_PLATFORM);
 		bool platform_init = this->initializePlatform();
-		bool provisioning_flow_init = this->initializeProvisioningFlow();
+		this->startupPhaseEnd(StartupTimer::PHASE_PLATFORM);
+		if (platform_init) {
+			this->startupPhaseBegin(StartupTimer::PHASE_PROVISIONING);
+			provisioning_flow_init = this->initializeProvisioningFlow();
+			this->startupPhaseEnd(StartupTimer::PHASE_PROVISIONING);
+		}
 		if (platform_init && provisioning_flow_init) {
 			// create a new instance of mbedCloudClient
-			this->logger()->log("createCloudEndpointInterface: creating mbed cloud client instance...");
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"createCloudEndpointInterface: creating mbed cloud client instance...");
 			this->m_endpoint_interface = new MbedCloudClient();
 			if (this->m_endpoint_interface == NULL) {
 				// unable to allocate the MbedCloudClient instance
-				this->logger()->log("createCloudEndpointInterface: ERROR: unable to allocate MbedCloudClient instance...");
+				LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"createCloudEndpointInterface: ERROR: unable to allocate MbedCloudClient instance...");
 			} else {
 #ifdef MBED_CLOUD_CLIENT_SUPPORT_UPDATE		
 				// Establish the updater hook in MbedCloudClient
@@ -252,10 +302,10 @@ void Endpoint::createCloudEndpointInterface() {
 		} else {
 			if (platform_init) {
 				// unable to create mbed cloud client instance... (FAILED provisioning flow init)
-				this->logger()->log("createCloudEndpointInterface: ERROR: unable to initialize provisioning flow...");
+				LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"createCloudEndpointInterface: ERROR: unable to initialize provisioning flow...");
 			} else {
 				// unable to create mbed cloud client instance... (FAILED platform init)
-				this->logger()->log("createCloudEndpointInterface: ERROR: unable to initialize platform...");
+				LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"createCloudEndpointInterface: ERROR: unable to initialize platform...");
 			}
 			this->m_endpoint_interface = NULL;
 		}
@@ -263,7 +313,7 @@ void Endpoint::createCloudEndpointInterface() {
 
 	// bind LWIP network interface pointer...
 	if (__network_interface != NULL && this->m_endpoint_interface != NULL) {
-		this->logger()->log("Connector::Endpoint: binding LWIP network instance (Cloud)...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: binding LWIP network instance (Cloud)...");
 		this->m_endpoint_interface->on_registered(
 				&Connector::Endpoint::on_registered);
 		this->m_endpoint_interface->on_unregistered(
@@ -272,7 +322,7 @@ void Endpoint::createCloudEndpointInterface() {
 		this->m_endpoint_interface->set_update_callback(this);
 	} else {
 		// skipping LWIP bind...
-		this->logger()->log("Connector::Endpoint: ERROR (Cloud) skipping LWIP network instance bind due to previous error...");
+		LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: ERROR (Cloud) skipping LWIP network instance bind due to previous error...");
 	}
 }
 
@@ -365,34 +415,34 @@ void Endpoint::on_error(int error_code) {
 void Endpoint::error(M2MInterface::Error error) {
     switch (error) {
         case M2MInterface::AlreadyExists:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::AlreadyExists");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::AlreadyExists");
                 break;
         case M2MInterface::BootstrapFailed:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::BootstrapFailed");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::BootstrapFailed");
                 break;
         case M2MInterface::InvalidParameters:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::InvalidParameters");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::InvalidParameters");
                 break;
         case M2MInterface::NotRegistered:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::NotRegistered");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::NotRegistered");
                 break;
         case M2MInterface::Timeout:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::Timeout");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::Timeout");
                 break;
         case M2MInterface::NetworkError:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::NetworkError");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::NetworkError");
                 break;
         case M2MInterface::ResponseParseFailed:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::ResponseParseFailed");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::ResponseParseFailed");
                 break;
         case M2MInterface::UnknownError:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::UnknownError");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::UnknownError");
                 break;
         case M2MInterface::MemoryFail:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::MemoryFail");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::MemoryFail");
                 break;
         case M2MInterface::NotAllowed:
-                this->logger()->log("Connector::Endpoint(ERROR): M2MInterface::NotAllowed");
+                LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(ERROR): M2MInterface::NotAllowed");
                 break;
         default:
                 break;
@@ -403,7 +453,8 @@ void Endpoint::error(M2MInterface::Error error) {
 void Endpoint::re_register_endpoint() {
 	if (this->m_endpoint_interface != NULL) {
 		// DEBUG
-		this->logger()->log("Connector::Endpoint(Cloud): re-register endpoint...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(Cloud): re-register endpoint...");
+		this->m_endpoint_interface->setup(__network_interface);
 	}
 }
 
@@ -411,19 +462,21 @@ void Endpoint::re_register_endpoint() {
 void Endpoint::de_register_endpoint(void) {
 	if (this->m_endpoint_interface != NULL) {
 		// DEBUG
-		this->logger()->log("Connector::Endpoint(Cloud): de-registering endpoint...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(Cloud): de-registering endpoint...");
+		this->m_deregistering = true;
 		this->m_endpoint_interface->close();
 	}
 }
 
 // register the endpoint
-void Endpoint::register_endpoint(M2MSecurity *endpoint_security,
+void Endpoint::register_endpoint(M2MSecurity * /* endpoint_security */,
 		M2MObjectList endpoint_objects) {
 	if (this->m_endpoint_interface != NULL) {
-		this->logger()->log("Connector::Endpoint(Cloud): adding objects to endpoint...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(Cloud): adding objects to endpoint...");
 		this->m_endpoint_interface->add_objects(endpoint_objects);
 
-		this->logger()->log("Connector::Endpoint(Cloud): registering endpoint...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint(Cloud): registering endpoint...");
+		this->startupPhaseBegin(StartupTimer::PHASE_REGISTRATION);
 		this->m_endpoint_interface->setup(__network_interface);
 	}
 }
@@ -467,27 +520,37 @@ void Endpoint::registration_updated(M2MSecurity *security,
 // object unregistered
 void Endpoint::object_unregistered(M2MSecurity *security) {
 	// DEBUG
-	this->logger()->log("Connector::Endpoint: endpoint de-registered.");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: endpoint de-registered.");
 
-	// no longer connected/registered
+	// no longer registered
 	this->m_registered = false;
-	this->m_connected = false;
-
-	// stop all observers...
-	this->stopObservations();
+	
+	// with a NotificationStore we ride out an outage we did not ask for: observers keep sampling into the store until we re-register
+	bool ride_out = (this->m_notification_store != NULL && this->m_deregistering == false);
+	if (ride_out == false) {
+		// no longer connected... stop all observers
+		this->m_connected = false;
+		this->stopObservations();
+	}
+	else {
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: recording notifications until re-registered...");
+	}
 
 	// invoke ConnectionHandler if we have one...
 	if (this->m_csi != NULL) {
 		this->m_csi->object_unregistered((void *) this, (void *) security);
 	}
+	net_registration_changed();
 
-	// halt the main event loop... we are done.
-	net_shutdown_endpoint();
+	// halt the main event loop... we are done (the main loop re-registers instead if we are riding out an outage).
+	if (ride_out == false) {
+		net_shutdown_endpoint();
+	}
 }
 
 // bootstrap done
 void Endpoint::bootstrap_done(M2MSecurity *security) {
-	this->logger()->log("Connector::Endpoint: endpoint bootstrapped.");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: endpoint bootstrapped.");
 	if (this->m_csi != NULL) {
 		this->m_csi->bootstrapped((void *) this, (void *) security);
 	}
@@ -495,22 +558,38 @@ void Endpoint::bootstrap_done(M2MSecurity *security) {
 
 // object registered
 void Endpoint::object_registered(void *security, void *server) {
-	this->logger()->log("Connector::Endpoint: endpoint registered.");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: endpoint registered.");
 	this->m_connected = true;
 	this->m_registered = true;
+	
+	// first registration completes startup
+	if (this->m_startup_timer.isComplete(StartupTimer::PHASE_REGISTRATION) == false) {
+		this->startupPhaseEnd(StartupTimer::PHASE_REGISTRATION);
+		uint32_t total_ms = this->m_startup_timer.elapsed();
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: startup completed in %lu ms:",(unsigned long)total_ms);
+		this->m_startup_timer.logTimings(this->logger());
+		if (this->m_csi != NULL) {
+			this->m_csi->startup_completed((void *) this, total_ms);
+		}
+	}
 	if (this->m_csi != NULL) {
 		this->m_csi->object_registered((void *) this, security, server);
 	}
+	net_registration_changed();
+	
+	// forward anything recorded while we were unregistered
+	this->replayNotifications();
 }
 
 // registration updated
 void Endpoint::registration_updated(void *security, void *server) {
-	this->logger()->log("Connector::Endpoint: endpoint re-registered.");
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: endpoint re-registered.");
 	this->m_connected = true;
 	this->m_registered = true;
 	if (this->m_csi != NULL) {
 		this->m_csi->registration_updated((void *) this, security, server);
 	}
+	net_registration_changed();
 }
 
 // resource value updated
@@ -522,7 +601,14 @@ void Endpoint::value_updated(M2MBase *base, M2MBase::BaseType type) {
 		//this->logger()->log("Value Updated (Custom Resource)");
 
 		// its a custom resource...
-		target_res->process(base->operation(), type);
+		if (this->m_inbound_dispatcher != NULL) {
+			// hand off to our worker thread
+			this->m_inbound_dispatcher->dispatch(target_res, base->operation(), type);
+		}
+		else {
+			// process in the mbed-client context
+			target_res->process(base->operation(), type);
+		}
 	}
 
 	// CSI
@@ -531,17 +617,16 @@ void Endpoint::value_updated(M2MBase *base, M2MBase::BaseType type) {
 	}
 }
 
-// lookup which DynamicResource cooresponds to a given M2MBase instance...
+// lookup which DynamicResource cooresponds to a given M2MBase instance (every bound DynamicResource is indexed... a miss is not ours)
 DynamicResource *Endpoint::lookupDynamicResource(M2MBase *base) {
-	const DynamicResourcesList *dynamic_resources =
-			this->m_options->getDynamicResourceList();
-	for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
-		M2MBase *t = (M2MBase *) dynamic_resources->at(i)->getResource();
-		if (t == base) {
-			return dynamic_resources->at(i);
-		}
+	return this->m_dynamic_resource_index.lookup((const void *)base);
+}
+
+// index a DynamicResource as it is bound
+void Endpoint::indexDynamicResource(DynamicResource *resource) {
+	if (this->m_dynamic_resource_index.add(resource) == false && resource != NULL) {
+		LOG_WARN(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: unable to index [%s]... inbound requests for it are ignored",resource->getFullName().c_str());
 	}
-	return NULL;
 }
 
 // build out the endpoint
@@ -551,40 +636,101 @@ void Endpoint::buildEndpoint() {
 
 	// make sure we have an endpoint interface...
 	if (this->getEndpointInterface() != NULL) {
+		// resources index themselves as they are bound (a rebuild binds them all again)
+		this->m_dynamic_resource_index.clear();
+		
 		// We now have to bind our device resources
 		if (this->m_device_manager != NULL) {
 			// DEBUG
-			this->logger()->log("Connector::Endpoint::build(): plumbing the device management objects and resources...");
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): plumbing the device management objects and resources...");
 
 			// bind the device manager
+			this->startupPhaseBegin(StartupTimer::PHASE_BIND_DEVICE_MANAGER);
 			((DeviceManager *) this->m_device_manager)->bind();
+			this->startupPhaseEnd(StartupTimer::PHASE_BIND_DEVICE_MANAGER);
 		}
 		else {
 			// no device manager installed
-			this->logger()->log("Connector::Endpoint::build(): No device manager installed.");
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): No device manager installed.");
 		}
 		
 		// Loop through Static Resources and bind each of them...
-		this->logger()->log("Connector::Endpoint::build(): adding static resources...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): adding static resources...");
 		const StaticResourcesList *static_resources =
 				this->m_options->getStaticResourceList();
+		this->startupPhaseBegin(StartupTimer::PHASE_BIND_STATIC);
 		for (int i = 0; i < (int) static_resources->size(); ++i) {
-			this->logger()->log("Connector::Endpoint::build(): binding static resource: [%s]...",static_resources->at(i)->getFullName().c_str());
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): binding static resource: [%s]...",static_resources->at(i)->getFullName().c_str());
 			static_resources->at(i)->bind(this);
 		}
+		this->startupPhaseEnd(StartupTimer::PHASE_BIND_STATIC);
 
 		// Loop through Dynamic Resources and bind each of them...
-		this->logger()->log("Connector::Endpoint::build(): adding dynamic resources...");
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): adding dynamic resources...");
 		const DynamicResourcesList *dynamic_resources =
 				this->m_options->getDynamicResourceList();
+		this->startupPhaseBegin(StartupTimer::PHASE_BIND_DYNAMIC);
 		for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
-			this->logger()->log("Connector::Endpoint::build(): binding dynamic resource: [%s]...",dynamic_resources->at(i)->getFullName().c_str());
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): binding dynamic resource: [%s]...",dynamic_resources->at(i)->getFullName().c_str());
 			dynamic_resources->at(i)->bind(this);
 		}
+		this->startupPhaseEnd(StartupTimer::PHASE_BIND_DYNAMIC);
+		
+		// lazily bound values are resolved in the background... registration does not wait for them
+		int pending = 0;
+		for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
+			if (dynamic_resources->at(i)->isValuePending() == true) {
+				++pending;
+			}
+		}
+		if (pending > 0) {
+			// a resolver left over from an earlier build has either finished or is about to
+			this->joinLazyBindThread();
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): resolving %d lazily bound values in the background...",pending);
+			this->m_lazy_bind_thread = new Thread(osPriorityLow,LAZY_BIND_STACK_SIZE);
+			if (this->m_lazy_bind_thread != NULL && this->m_lazy_bind_thread->start(callback(this,&Endpoint::resolvePendingValues)) != osOK) {
+				delete this->m_lazy_bind_thread;
+				this->m_lazy_bind_thread = NULL;
+			}
+			if (this->m_lazy_bind_thread == NULL) {
+				LOG_WARN(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): unable to start lazy value resolver... values resolve on first observation");
+			}
+		}
+		
+		// each bound dynamic resource indexed itself for value_updated() dispatch
+		LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): dispatch index built (%d dynamic resources)...",this->m_dynamic_resource_index.size());
+		
+		// create our InboundDispatcher if one has been configured
+		if (this->m_inbound_dispatcher == NULL && this->m_options->getInboundDispatchDepth() > 0) {
+			this->m_inbound_dispatcher = new InboundDispatcher(this->m_logger,this->m_options->getInboundDispatchDepth(),this->m_options->getInboundDispatchOverflowPolicy());
+			if (this->m_inbound_dispatcher != NULL && this->m_inbound_dispatcher->start() == false) {
+				// unable to start... process inbound requests in the mbed-client context
+				delete this->m_inbound_dispatcher;
+				this->m_inbound_dispatcher = NULL;
+			}
+		}
+		
+		// create our NotificationCoalescer if one has been configured
+		if (this->m_coalescer == NULL && this->m_options->getNotificationCoalesceWindow() > 0) {
+			this->m_coalescer = new NotificationCoalescer(this->m_logger,this->m_options->getNotificationCoalesceWindow());
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): coalescing notifications (window: %lu ms)...",(unsigned long)this->m_options->getNotificationCoalesceWindow());
+		}
+		
+		// open our NotificationStore if one has been configured (restores records kept across a reset)
+		if (this->m_notification_store == NULL && this->m_options->getNotificationStore() != NULL) {
+			if (this->m_options->getNotificationStore()->open() == true) {
+				this->m_notification_store = this->m_options->getNotificationStore();
+				LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): notification store opened (%d stored notifications)...",this->m_notification_store->count());
+			}
+			else {
+				LOG_WARN(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::build(): unable to open notification store... notifications made while unregistered are discarded");
+			}
+		}
 
 		// Get the ObjectList from the ObjectInstanceManager...
-		NamedPointerList list =
+		const NamedPointerList &list =
 				this->getObjectInstanceManager()->getObjectList();
+		this->m_endpoint_object_list.reserve(this->m_endpoint_object_list.size() + list.size());
 
 		// DEBUG
 		//this->logger()->log("Endpoint::build(): All Resources bound. Number of Objects in list: %d",list.size());
@@ -600,8 +746,118 @@ void Endpoint::buildEndpoint() {
 		}
 	} else {
 		// no endpoint interface created
-		this->logger()->log("Endpoint::build(): ERROR in creating the endpoint interface...");
+		LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"Endpoint::build(): ERROR in creating the endpoint interface...");
+	}
+}
+
+// resolve lazily bound values (runs on the low priority resolver thread)
+void Endpoint::resolvePendingValues() {
+	const DynamicResourcesList *dynamic_resources =
+			this->m_options->getDynamicResourceList();
+	for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
+		// no-op if the first observation already resolved it
+		dynamic_resources->at(i)->resolvePendingValue();
 	}
+	LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: lazily bound values resolved.");
+}
+
+// wait for the lazy value resolver to finish and free it (its stack is only needed once)
+void Endpoint::joinLazyBindThread() {
+	if (this->m_lazy_bind_thread != NULL) {
+		this->m_lazy_bind_thread->join();
+		delete this->m_lazy_bind_thread;
+		this->m_lazy_bind_thread = NULL;
+	}
+}
+
+// replay any stored notifications
+void Endpoint::replayNotifications() {
+	if (this->m_notification_store == NULL || this->isOnline() == false || this->m_notification_store->count() == 0) {
+		return;
+	}
+	this->m_replay_mutex.lock();
+	if (this->m_replay_thread == NULL) {
+		// first replay... start the (low priority) replay thread
+		this->m_replay_buffer = (uint8_t *)malloc(MAX_VALUE_BUFFER_LENGTH);
+		this->m_replay_signal = new Semaphore(0,1);
+		this->m_replay_thread = new Thread(osPriorityLow,NOTIFICATION_REPLAY_STACK_SIZE);
+		if (this->m_replay_buffer == NULL || this->m_replay_signal == NULL || this->m_replay_thread == NULL || this->m_replay_thread->start(callback(this,&Endpoint::replayTask)) != osOK) {
+			LOG_WARN(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: unable to start notification replay... %d stored notifications kept",this->m_notification_store->count());
+			if (this->m_replay_thread != NULL) delete this->m_replay_thread;
+			if (this->m_replay_signal != NULL) delete this->m_replay_signal;
+			free(this->m_replay_buffer);
+			this->m_replay_thread = NULL;
+			this->m_replay_signal = NULL;
+			this->m_replay_buffer = NULL;
+			this->m_replay_mutex.unlock();
+			return;
+		}
+	}
+	this->m_replaying = true;
+	this->m_replay_signal->release();
+	this->m_replay_mutex.unlock();
+}
+
+// a replay is in progress
+bool Endpoint::isReplaying() {
+	return this->m_replaying;
+}
+
+// replay stored notifications in order, rate limited in batches (runs on the low priority replay thread)
+void Endpoint::replayTask() {
+	char name[NOTIFICATION_STORE_NAME_LENGTH+1];
+	uint64_t timestamp_ms = 0;
+	while (this->m_replay_stop == false) {
+		this->m_replay_signal->wait();
+		int replayed = 0;
+		int skipped = 0;
+		int batch = 0;
+		
+		// stop (keeping the remainder) if we lose our registration or link part way through
+		while (this->m_replay_stop == false && this->isOnline() == true) {
+			int data_length = this->m_notification_store->shift(name,sizeof(name),timestamp_ms,this->m_replay_buffer,MAX_VALUE_BUFFER_LENGTH);
+			if (data_length < 0) {
+				break;
+			}
+			DynamicResource *res = this->lookupDynamicResource(name);
+			if (res != NULL && res->getResource() != NULL) {
+				LOG_DEBUG(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: replaying [%s] (recorded at %llu ms)",name,(unsigned long long)timestamp_ms);
+				res->replayNotification(this->m_replay_buffer,data_length);
+				++replayed;
+				if (++batch >= NOTIFICATION_REPLAY_BATCH) {
+					// rate limit per batch (live notifications are queued behind us, so the replay must outpace them)
+					batch = 0;
+					ThisThread::sleep_for(NOTIFICATION_REPLAY_INTERVAL_MS);
+				}
+			}
+			else {
+				// resource no longer exists (i.e. restored from a previous build)
+				++skipped;
+			}
+		}
+		
+		// caught up: new notifications go straight out again (unless one was queued after our last shift)
+		this->m_replaying = false;
+		if (this->m_replay_stop == false && this->isOnline() == true && this->m_notification_store->count() > 0) {
+			this->m_replaying = true;
+			this->m_replay_signal->release();
+		}
+		if (replayed > 0 || skipped > 0) {
+			LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: replayed %d stored notifications (%d skipped, %lu dropped while offline)",replayed,skipped,(unsigned long)this->m_notification_store->dropped());
+		}
+	}
+}
+
+// lookup a DynamicResource by its full name
+DynamicResource *Endpoint::lookupDynamicResource(const char *full_name) {
+	const DynamicResourcesList *dynamic_resources =
+			this->m_options->getDynamicResourceList();
+	for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
+		if (dynamic_resources->at(i)->getFullName().compare(full_name) == 0) {
+			return dynamic_resources->at(i);
+		}
+	}
+	return NULL;
 }
 
 // stop underlying observation mechanisms
@@ -613,16 +869,24 @@ void Endpoint::stopObservations() {
 			ResourceObserver *observer =
 					(ResourceObserver *) dynamic_resources->at(i)->getObserver();
 			if (observer != NULL) {
-				this->logger()->log("Connector::Endpoint::stopObservations(): stopping resource observer for: [%s]...",dynamic_resources->at(i)->getFullName().c_str());
+				LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint::stopObservations(): stopping resource observer for: [%s]...",dynamic_resources->at(i)->getFullName().c_str());
 				observer->halt();
 			}
 		}
 	}
+	
+	// the resolver may still be calling get()... let it finish before the resources go idle
+	this->joinLazyBindThread();
 }
 
 // underlying network is connected (SET)
 void Endpoint::isConnected(bool connected) {
+	bool restored = (connected == true && this->m_connected == false);
 	this->m_connected = connected;
+	if (restored == true) {
+		// forward anything recorded while the link was down
+		this->replayNotifications();
+	}
 }
 
 // underlying network is connected (GET)
@@ -635,10 +899,41 @@ bool Endpoint::isRegistered() {
 	return this->m_registered;
 }
 
+// Registered and the underlying network is up (notifications can be delivered)
+bool Endpoint::isOnline() {
+	return this->m_registered == true && this->m_connected == true;
+}
+
 // Set the ConnectionStatusInterface
 void Endpoint::setConnectionStatusInterfaceImpl(
 		ConnectionStatusInterface *csi) {
 	this->m_csi = csi;
+	
+	// report any startup phases that completed before we had an interface
+	for (int i = 0; this->m_csi != NULL && i < StartupTimer::PHASE_COUNT; ++i) {
+		if (this->m_startup_timer.isComplete(i) == true) {
+			this->m_csi->startup_phase_completed((void *) this, i, this->m_startup_timer.duration(i), this->m_startup_timer.completedAt(i));
+		}
+	}
+}
+
+// Get our startup phase timings
+StartupTimer *Endpoint::getStartupTimer() {
+	return &this->m_startup_timer;
+}
+
+// mark the beginning of a startup phase
+void Endpoint::startupPhaseBegin(int phase) {
+	this->m_startup_timer.begin(phase);
+}
+
+// mark the completion of a startup phase
+void Endpoint::startupPhaseEnd(int phase) {
+	uint32_t duration_ms = this->m_startup_timer.end(phase);
+	LOG_DEBUG(this->logger(),LOGGER_MODULE_ENDPOINT,"Connector::Endpoint: startup phase [%s] took %lu ms",StartupTimer::name(phase),(unsigned long)duration_ms);
+	if (this->m_csi != NULL) {
+		this->m_csi->startup_phase_completed((void *) this, phase, duration_ms, this->m_startup_timer.completedAt(phase));
+	}
 }
 
 // Set our ObjectInstanceManager
@@ -651,6 +946,21 @@ ObjectInstanceManager *Endpoint::getObjectInstanceManager() {
 	return this->m_oim;
 }
 
+// Get our InboundDispatcher
+InboundDispatcher *Endpoint::getInboundDispatcher() {
+	return this->m_inbound_dispatcher;
+}
+
+// Get our NotificationCoalescer
+NotificationCoalescer *Endpoint::getNotificationCoalescer() {
+	return this->m_coalescer;
+}
+
+// Get our NotificationStore
+NotificationStore *Endpoint::getNotificationStore() {
+	return this->m_notification_store;
+}
+
 // our logger
 Logger *Endpoint::logger() {
 	return this->m_logger;
@@ -29,7 +29,8 @@
      this->m_data_length = 0;
      this->m_data_length_max = data_length;
      this->m_alloced = false;
-     this->reset();
+     if (this->m_data != NULL && this->m_data_length_max > 0)
+        memset(this->m_data,0,this->m_data_length_max);
  }
 
  // constructor (alloc)
@@ -76,10 +77,10 @@
      }
  }
 
- // reset
+ // reset (the buffer beyond m_data_length is always zero, so only the used portion needs clearing)
  void DataWrapper::reset() {
-     if (this->m_data != NULL && this->m_data_length_max > 0)
-        memset(this->m_data,0,this->m_data_length_max);
+     if (this->m_data != NULL && this->m_data_length > 0)
+        memset(this->m_data,0,this->m_data_length);
      this->m_data_length = 0;
  }
 
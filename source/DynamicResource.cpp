@@ -32,6 +32,11 @@
 // Endpoint 
 #include "mbed-connector-interface/ConnectorEndpoint.h"
 
+// numeric decoding support
+#include <limits.h>
+#include <ctype.h>
+#include <float.h>
+
 // GET option that can be used to Start/Stop Observations...
 #define START_OBS 0
 #define STOP_OBS  1
@@ -42,10 +47,24 @@
 // ContentFormat defaults for each DynamicResource
 #define DEFAULT_CONTENT_FORMAT 0
 
+// Longest text payload accepted by the numeric decoders
+#define MAX_NUMERIC_TEXT_LENGTH 48
+
+// ContentFormat whose numeric payloads use the LwM2M binary encoding (application/octet-stream)... all others are text
+#define BINARY_CONTENT_FORMAT 42
+
+// Notification attribute flags
+#define NOTIFY_ATTR_PMIN  0x01
+#define NOTIFY_ATTR_PMAX  0x02
+#define NOTIFY_ATTR_GT    0x04
+#define NOTIFY_ATTR_LT    0x08
+#define NOTIFY_ATTR_ST    0x10
+#define NOTIFY_ATTR_VALUE (NOTIFY_ATTR_GT | NOTIFY_ATTR_LT | NOTIFY_ATTR_ST)
+
 // default constructor
 DynamicResource::DynamicResource(const Logger *logger,const char *obj_name,const char *res_name,const char *res_type,uint8_t res_mask,const bool observable,const ResourceType type) : Resource<string>(logger,string(obj_name),string(res_name),string(""))
 {
-    this->m_res_type = string(res_type);
+    this->m_res_type = IdentifierTable::instance()->str(IdentifierTable::instance()->internString(res_type));
     this->m_type = type;
     this->m_observable = observable;
     this->m_res_mask = res_mask;
@@ -56,12 +75,22 @@ DynamicResource::DynamicResource(const Logger *logger,const char *obj_name,const
     this->m_content_format = DEFAULT_CONTENT_FORMAT;
     this->m_ep = NULL;
     this->m_res = NULL;
+    this->m_suppress_unchanged = false;
+    this->m_force_refresh_periods = 0;
+    this->m_periods_since_emit = 0;
+    this->m_last_hash = 0;
+    this->m_last_length = -1;
+    this->m_suppressed_count = 0;
+    this->m_emitted_count = 0;
+    this->m_lazy_bind = false;
+    this->m_value_pending = 0;
+    this->clearNotificationAttributes();
 }
 
 // constructor (input initial value)
 DynamicResource::DynamicResource(const Logger *logger,const char *obj_name,const char *res_name,const char *res_type,const string value,uint8_t res_mask,const bool observable,const ResourceType type) : Resource<string>(logger,string(obj_name),string(res_name),value)
 {
-    this->m_res_type = string(res_type);
+    this->m_res_type = IdentifierTable::instance()->str(IdentifierTable::instance()->internString(res_type));
     this->m_type = type;
     this->m_observable = observable;
     this->m_res_mask = res_mask;
@@ -72,12 +101,22 @@ DynamicResource::DynamicResource(const Logger *logger,const char *obj_name,const
     this->m_content_format = DEFAULT_CONTENT_FORMAT;
     this->m_ep = NULL;
     this->m_res = NULL;
+    this->m_suppress_unchanged = false;
+    this->m_force_refresh_periods = 0;
+    this->m_periods_since_emit = 0;
+    this->m_last_hash = 0;
+    this->m_last_length = -1;
+    this->m_suppressed_count = 0;
+    this->m_emitted_count = 0;
+    this->m_lazy_bind = false;
+    this->m_value_pending = 0;
+    this->clearNotificationAttributes();
 }
 
 // constructor (strings)
 DynamicResource::DynamicResource(const Logger *logger,const string obj_name,const string res_name,const string res_type,const string value,uint8_t res_mask,const bool observable,const ResourceType type) : Resource<string>(logger,obj_name,res_name,value)
 {
-    this->m_res_type = res_type;
+    this->m_res_type = IdentifierTable::instance()->str(IdentifierTable::instance()->internString(res_type.c_str()));
     this->m_type = type;
     this->m_observable = observable;
     this->m_res_mask = res_mask;
@@ -88,6 +127,16 @@ DynamicResource::DynamicResource(const Logger *logger,const string obj_name,cons
     this->m_content_format = DEFAULT_CONTENT_FORMAT;
     this->m_ep = NULL;
     this->m_res = NULL;
+    this->m_suppress_unchanged = false;
+    this->m_force_refresh_periods = 0;
+    this->m_periods_since_emit = 0;
+    this->m_last_hash = 0;
+    this->m_last_length = -1;
+    this->m_suppressed_count = 0;
+    this->m_emitted_count = 0;
+    this->m_lazy_bind = false;
+    this->m_value_pending = 0;
+    this->clearNotificationAttributes();
 }
 
 // copy constructor
@@ -104,6 +153,26 @@ DynamicResource::DynamicResource(const DynamicResource &resource) : Resource<str
     this->m_content_format = resource.m_content_format;
     this->m_ep = resource.m_ep;
     this->m_res = resource.m_res;
+    this->m_suppress_unchanged = resource.m_suppress_unchanged;
+    this->m_force_refresh_periods = resource.m_force_refresh_periods;
+    this->m_periods_since_emit = resource.m_periods_since_emit;
+    this->m_last_hash = resource.m_last_hash;
+    this->m_last_length = resource.m_last_length;
+    this->m_suppressed_count = resource.m_suppressed_count;
+    this->m_emitted_count = resource.m_emitted_count;
+    this->m_attributes = resource.m_attributes;
+    this->m_pmin_ms = resource.m_pmin_ms;
+    this->m_pmax_ms = resource.m_pmax_ms;
+    this->m_gt = resource.m_gt;
+    this->m_lt = resource.m_lt;
+    this->m_st = resource.m_st;
+    this->m_notified = resource.m_notified;
+    this->m_last_notify_ms = resource.m_last_notify_ms;
+    this->m_last_value_valid = resource.m_last_value_valid;
+    this->m_last_value = resource.m_last_value;
+    this->m_change_pending = resource.m_change_pending;
+    this->m_lazy_bind = resource.m_lazy_bind;
+    this->m_value_pending = resource.m_value_pending;
 }
 
 // destructor
@@ -120,27 +189,35 @@ void DynamicResource::bind(void *ep) {
 		ObjectInstanceManager *oim = endpoint->getObjectInstanceManager();
 		
 		// Create our Resource
-		this->m_res = (M2MResource *)oim->createDynamicResourceInstance((char *)this->getObjName().c_str(),(char *)this->getResName().c_str(),(char *)this->m_res_type.c_str(),(int)this->m_type,this->m_observable);
+		this->m_res = (M2MResource *)oim->createDynamicResourceInstance(this->getObjId(),this->getResId(),this->m_res_type,(int)this->m_type,this->m_observable);
 		if (this->m_res != NULL) {
 			// Record our Instance Number
 			this->setInstanceNumber(oim->getLastCreatedInstanceNumber());
+			
+			// index ourselves for inbound request dispatch
+			endpoint->indexDynamicResource(this);
 			   
-			// perform an initial get() to initialize our data value
-			this->setValue(this->get());
+			// perform an initial get() to initialize our data value (lazy: bind with the placeholder value, resolved later)
+			if (this->m_lazy_bind == true) {
+				this->m_value_pending = 1;
+			}
+			else {
+				this->setValue(this->get());
+			}
 			
 			// now record the data value         			
 			if (this->getDataWrapper() != NULL) {
 				// wrap the data...
 				this->getDataWrapper()->wrap((uint8_t *)this->getValue().c_str(),(int)this->getValue().size());
 				this->m_res->set_operation((M2MBase::Operation)this->m_res_mask);
-				this->m_res->set_value( this->getDataWrapper()->get(),(uint8_t)this->getDataWrapper()->length());
-				this->logger()->log("%s: [%s] value: [%s] bound (observable: %d)",this->m_res_type.c_str(),this->getFullName().c_str(),this->getDataWrapper()->get(),this->m_observable);
+				this->m_res->set_value( this->getDataWrapper()->get(),(uint32_t)this->getDataWrapper()->length());
+				LOG_INFO(this->logger(),LOGGER_MODULE_RESOURCE,"%s: [%s] value: [%s] bound (observable: %d)",this->m_res_type,this->getFullName().c_str(),this->getDataWrapper()->get(),this->m_observable);
 			}
 			else {
 				// do not wrap the data...
 				this->m_res->set_operation((M2MBase::Operation)this->m_res_mask);
-				this->m_res->set_value((uint8_t *)this->getValue().c_str(),(uint8_t)this->getValue().size());
- 				this->logger()->log("%s: [%s] value: [%s] bound (observable: %d)",this->m_res_type.c_str(),this->getFullName().c_str(),this->getValue().c_str(),this->m_observable);
+				this->m_res->set_value((uint8_t *)this->getValue().c_str(),(uint32_t)this->getValue().size());
+ 				LOG_INFO(this->logger(),LOGGER_MODULE_RESOURCE,"%s: [%s] value: [%s] bound (observable: %d)",this->m_res_type,this->getFullName().c_str(),this->getValue().c_str(),this->m_observable);
 			}
 			
 			// set our endpoint instance
@@ -156,7 +233,7 @@ void DynamicResource::bind(void *ep) {
 	}
 	else {
 		// no instance pointer to our endpoint
-      	this->logger()->log("%s: NULL endpoint instance pointer in bind() request...",this->m_res_type.c_str());
+      	LOG_ERROR(this->logger(),LOGGER_MODULE_RESOURCE,"%s: NULL endpoint instance pointer in bind() request...",this->m_res_type);
     }
 }
 
@@ -174,6 +251,11 @@ void DynamicResource::process_resource_post(void *args) {
 
 // process inbound mbed-client message
 uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,void *args) {
+	return this->process(op,type,this->m_res->value(),(int)this->m_res->value_length(),args);
+}
+
+// process inbound requests against a given payload
+uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,uint8_t *payload,int payload_length,void *args) {
 #if defined (HAS_EXECUTE_PARAMS)
      M2MResource::M2MExecuteParameter* param = NULL;
      
@@ -183,32 +265,28 @@ uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,vo
      }
 #endif	
 	// DEBUG
-	//this->logger()->log("in %s::process()  Operation=0x0%x Type=%x%x",this->m_res_type.c_str(),op,type);
+	//this->logger()->log("in %s::process()  Operation=0x0%x Type=%x%x",this->m_res_type,op,type);
 	
 	// PUT() check
 	if ((op & M2MBase::PUT_ALLOWED) != 0) {
-		string value = this->coapDataToString(this->m_res->value(),this->m_res->value_length());
-	 	this->logger()->log("%s: put(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),value.c_str());
-     	this->put(value.c_str());
+	 	LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: put(%d) [%s] called.",this->m_res_type,type,this->getFullName().c_str());
+     	this->putPayload(payload,payload_length);
      	return 0;
     }
  
 #if defined (HAS_EXECUTE_PARAMS)   
     // POST() check
 	if ((op & M2MBase::POST_ALLOWED) != 0) {
-	    string value;
 	    if (param != NULL) {
-	    	// use parameters
-	    	String object_name = param->get_argument_object_name();
-	    	int instance_id = (int)param->get_argument_object_instance_id();
-	    	String resource_name = param->get_argument_resource_name();
-	    	value = this->coapDataToString((uint8_t *)param->get_argument_value(),param->get_argument_value_length());
-	    	this->logger()->log("%s: post(%d) [%s/%d/%s]=[%s]) called.",this->m_res_type.c_str(),type,object_name.c_str(),instance_id,resource_name.c_str(),value.c_str());
+	    	// use parameters (decoded only when the debug statement is enabled)
+	    	LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: post(%d) [%s/%d/%s]=[%s]) called.",this->m_res_type,type,param->get_argument_object_name().c_str(),
+	    			  (int)param->get_argument_object_instance_id(),param->get_argument_resource_name().c_str(),
+	    			  this->coapDataToString((uint8_t *)param->get_argument_value(),param->get_argument_value_length()).c_str());
 	    }
 	    else {
-	    	// use the resource value itself
-			value = this->coapDataToString((uint8_t *)this->m_res->value(),this->m_res->value_length());
-	 		this->logger()->log("%s: post(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),value.c_str());
+	    	// use the resource value itself (decoded only when the debug statement is enabled)
+	 		LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: post(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),
+	 				  this->coapDataToString(payload,payload_length).c_str());
      	}
      	
      	// invoke
@@ -219,12 +297,12 @@ uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,vo
     // POST() check
 	if ((op & M2MBase::POST_ALLOWED) != 0) {
 		if (args != NULL) {
-			this->logger()->log("%s: post(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),(char *)args);
+			LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: post(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),(char *)args);
 	     	this->post(args);
      	}
      	else {
-     		string value = this->coapDataToString((uint8_t *)this->m_res->value(),this->m_res->value_length());
-		 	this->logger()->log("%s: post(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),value.c_str());
+     		string value = this->coapDataToString(payload,payload_length);
+		 	LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: post(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),value.c_str());
 	     	this->post((void *)value.c_str());
      	}
      	return 0;
@@ -235,17 +313,15 @@ uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,vo
 	// DELETE() check
 	if ((op & M2MBase::DELETE_ALLOWED) != 0) {
 		if (param != NULL) {
-	    	// use parameters
-	    	String object_name = param->get_argument_object_name();
-	    	int instance_id = (int)param->get_argument_object_instance_id();
-	    	String resource_name = param->get_argument_resource_name();
-	    	string value = this->coapDataToString((uint8_t *)param->get_argument_value(),param->get_argument_value_length());
-	    	this->logger()->log("%s: delete(%d) [%s/%d/%s]=[%s]) called.",this->m_res_type.c_str(),type,object_name.c_str(),instance_id,resource_name.c_str(),value.c_str());
+	    	// use parameters (decoded only when the debug statement is enabled)
+	    	LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: delete(%d) [%s/%d/%s]=[%s]) called.",this->m_res_type,type,param->get_argument_object_name().c_str(),
+	    			  (int)param->get_argument_object_instance_id(),param->get_argument_resource_name().c_str(),
+	    			  this->coapDataToString((uint8_t *)param->get_argument_value(),param->get_argument_value_length()).c_str());
 	    }
 	    else {
-	    	// use the resource value itself
-			string value = this->coapDataToString((uint8_t *)this->m_res->value(),this->m_res->value_length());
-	 		this->logger()->log("%s: delete(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),value.c_str());
+	    	// use the resource value itself (decoded only when the debug statement is enabled)
+	 		LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: delete(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),
+	 				  this->coapDataToString(payload,payload_length).c_str());
      	}
      	
      	// invoke
@@ -256,30 +332,31 @@ uint8_t DynamicResource::process(M2MBase::Operation op,M2MBase::BaseType type,vo
     // DELETE() check
 	if ((op & M2MBase::DELETE_ALLOWED) != 0) {
 		if (args != NULL) {
-			this->logger()->log("%s: delete(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),(char *)args);
+			LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: delete(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),(char *)args);
 	     	this->del(args);
      	}
      	else {
-     		string value = this->coapDataToString((uint8_t *)this->m_res->value(),this->m_res->value_length());
-		 	this->logger()->log("%s: delete(%d) [%s]=[%s] called.",this->m_res_type.c_str(),type,this->getFullName().c_str(),value.c_str());
+     		string value = this->coapDataToString(payload,payload_length);
+		 	LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: delete(%d) [%s]=[%s] called.",this->m_res_type,type,this->getFullName().c_str(),value.c_str());
 	     	this->del((void *)value.c_str());
      	}
+     	return 0;
      }
 #endif
      
      // unknown type...
-     this->logger()->log("%s: Unknown Operation (0x%x) for [%s]=[%s]... FAILED.",op,this->m_res_type.c_str(),this->getFullName().c_str(),this->m_res->value());
+     LOG_ERROR(this->logger(),LOGGER_MODULE_RESOURCE,"%s: Unknown Operation (0x%x) for [%s]=[%s]... FAILED.",this->m_res_type,op,this->getFullName().c_str(),this->coapDataToString(payload,payload_length).c_str());
      return 1;
 }
 
 // send the notification
-int DynamicResource::notify(const string data) {
-    return this->notify((uint8_t *)data.c_str(),(int)data.length());
+int DynamicResource::notify(const string &data) {
+    return this->notify((const uint8_t *)data.c_str(),(int)data.length());
 }
 
 // send the notification
-int DynamicResource::notify(uint8_t *data,int data_length) {
-    uint8_t *notify_data = NULL;
+int DynamicResource::notify(const uint8_t *data,int data_length) {
+    const uint8_t *notify_data = NULL;
     int notify_data_length = 0;
     int status = 0;
 
@@ -304,13 +381,51 @@ int DynamicResource::notify(uint8_t *data,int data_length) {
         notify_data = data;
     }
     
-    // update the resource
-    this->m_res->set_value((uint8_t *)notify_data,(uint8_t)notify_data_length);
+    // while unregistered or the link is down (or while older notifications are still being replayed) record the notification for later
+    // (neither the store nor the coalescer may be used from ISR context: they lock and allocate... notify directly there)
+    Connector::Endpoint *ep = (Connector::Endpoint *)this->m_endpoint;
+    bool isr = core_util_is_isr_active();
+    NotificationStore *store = (ep != NULL && isr == false) ? ep->getNotificationStore() : NULL;
+    if (store != NULL && this->m_res != NULL) {
+        bool online = ep->isOnline();
+        if (online == false || store->count() > 0 || ep->isReplaying() == true) {
+            if (store->push(this->getFullName().c_str(),NotificationStore::now(),notify_data,notify_data_length) == false) {
+                LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"%s: [%s] WARNING unable to store %d byte notification",this->m_res_type,this->getFullName().c_str(),notify_data_length);
+            }
+            if (online == true) {
+                ep->replayNotifications();
+            }
+            return status;
+        }
+    }
+    
+    // hold the notification so that it is sent together with those of other resources
+    NotificationCoalescer *coalescer = (ep != NULL && isr == false) ? ep->getNotificationCoalescer() : NULL;
+    if (coalescer != NULL && this->m_res != NULL && coalescer->submit(this,notify_data,notify_data_length) == true) {
+        return status;
+    }
+    
+    // update the resource (mbed-client copies the value into the resource directly)
+    this->m_res->set_value(notify_data,(uint32_t)notify_data_length);
 
     // return our status
     return status;
 }
 
+// write a stored or coalesced notification
+void DynamicResource::replayNotification(const uint8_t *data,int data_length) {
+    if (this->m_res != NULL) {
+        this->m_res->set_value(data,(uint32_t)data_length);
+    }
+}
+
+// default PUT payload handling (convert to string and dispatch to put())
+void DynamicResource::putPayload(uint8_t *data,int data_length) {
+    string value = this->coapDataToString(data,data_length);
+    LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: [%s]=[%s]",this->m_res_type,this->getFullName().c_str(),value.c_str());
+    this->put(value.c_str());
+}
+
 // default GET (does nothing)
 string DynamicResource::get()
 {
@@ -340,11 +455,358 @@ void DynamicResource::del(void * /* args */)
     //this->logger()->log("DynamicResource::del() invoked (NOOP)");
 }
 
+// lazy initial value resolution
+void DynamicResource::setLazyBind(bool lazy) {
+    this->m_lazy_bind = lazy;
+}
+
+// resolve a placeholder value left by a lazy bind()
+void DynamicResource::resolvePendingValue() {
+    if (this->m_res != NULL && this->claimPendingValue() == true) {
+        string value = this->get();
+        this->setValue(value);
+        this->notify((const uint8_t *)value.c_str(),(int)value.length());
+        LOG_DEBUG(this->logger(),LOGGER_MODULE_RESOURCE,"%s: [%s] lazy value resolved: [%s]",this->m_res_type,this->getFullName().c_str(),value.c_str());
+    }
+}
+
+// claim the lazy bind placeholder (only one of the observer and the background resolver may replace it)
+bool DynamicResource::claimPendingValue() {
+    uint8_t pending = 1;
+    return this->m_value_pending != 0 && core_util_atomic_cas_u8(&this->m_value_pending,&pending,0) == true;
+}
+
 // default observe behavior
 void DynamicResource::observe() {
-    if (this->m_observable == true && this->isRegistered() == true) {
-        this->notify(this->get());
+    if (this->canObserve() == true) {
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+        // time get() on its own (the notification that follows is not the resource's cost)
+        uint32_t start_us = us_ticker_read();
+        string value = this->get();
+        this->recordGetTime(start_us);
+#else
+        string value = this->get();
+#endif
+        this->observeValue((const uint8_t *)value.c_str(),(int)value.length());
+    }
+}
+
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+// record the time a get() started at start_us took with our observer
+void DynamicResource::recordGetTime(uint32_t start_us) {
+    if (this->m_observer != NULL) {
+        ((ResourceObserver *)this->m_observer)->recordGetTime(us_ticker_read() - start_us);
+    }
+}
+#endif
+
+// observations proceed while registered, or while unregistered if a NotificationStore will record them
+bool DynamicResource::canObserve() {
+    if (this->m_observable == false) {
+        return false;
+    }
+    if (this->isRegistered() == true) {
+        return true;
+    }
+    Connector::Endpoint *ep = (Connector::Endpoint *)this->m_endpoint;
+    return (ep != NULL && ep->getNotificationStore() != NULL);
+}
+
+// notify an observed value (honoring notification attributes and change suppression if enabled)
+int DynamicResource::observeValue(const uint8_t *data,int data_length) {
+    uint64_t now = 0;
+    bool pmax_due = false;
+    bool have_value = false;
+    float value = 0.0;
+
+    // the first value of a lazily bound resource always replaces the bind-time placeholder
+    bool placeholder = this->claimPendingValue();
+    if (this->m_attributes != 0) {
+        now = Kernel::get_ms_count();
+        if (this->attributesAllowNotify(data,data_length,now,pmax_due,have_value,value) == false && placeholder == false) {
+            ++this->m_periods_since_emit;
+            ++this->m_suppressed_count;
+            return 0;
+        }
+    }
+    if (this->m_suppress_unchanged == true) {
+        uint32_t hash = DynamicResource::hashValue(data,data_length);
+        bool unchanged = (data_length == this->m_last_length && hash == this->m_last_hash);
+        bool refresh_due = (this->m_force_refresh_periods > 0 && this->m_periods_since_emit + 1 >= this->m_force_refresh_periods);
+        if (unchanged == true && refresh_due == false && pmax_due == false && placeholder == false) {
+            // same payload as last sent... skip set_value()
+            ++this->m_periods_since_emit;
+            ++this->m_suppressed_count;
+            return 0;
+        }
+        this->m_last_hash = hash;
+        this->m_last_length = data_length;
+    }
+    if (this->m_attributes != 0) {
+        this->m_notified = true;
+        this->m_last_notify_ms = now;
+        this->m_last_value_valid = have_value;
+        this->m_last_value = value;
+        this->m_change_pending = false;
+    }
+    this->m_periods_since_emit = 0;
+    ++this->m_emitted_count;
+    return this->notify(data,data_length);
+}
+
+// evaluate the notification attributes for a sampled value
+bool DynamicResource::attributesAllowNotify(const uint8_t *data,int data_length,uint64_t now,bool &pmax_due,bool &have_value,float &value) {
+    uint64_t elapsed = now - this->m_last_notify_ms;
+
+    // parse the sampled value if any value based attributes are set
+    if ((this->m_attributes & NOTIFY_ATTR_VALUE) != 0) {
+        have_value = DynamicResource::parseTextFloat(data,data_length,value);
+    }
+
+    // pmin: never notify sooner than pmin after the last notification... but remember a change so that it is not lost
+    bool changed = this->attributesChanged(have_value,value);
+    if ((this->m_attributes & NOTIFY_ATTR_PMIN) != 0 && this->m_notified == true && elapsed < (uint64_t)this->m_pmin_ms) {
+        if (changed == true) {
+            this->m_change_pending = true;
+        }
+        return false;
+    }
+
+    // pmax: always notify once pmax has elapsed
+    if ((this->m_attributes & NOTIFY_ATTR_PMAX) != 0 && (this->m_notified == false || elapsed >= (uint64_t)this->m_pmax_ms)) {
+        pmax_due = true;
+        return true;
+    }
+
+    // a change held back by pmin is sent with the first observation after pmin has elapsed
+    return (changed == true || this->m_change_pending == true);
+}
+
+// evaluate the value based attributes (gt/lt/st) for a sampled value
+bool DynamicResource::attributesChanged(bool have_value,float value) {
+    // no value based attributes (or non-numeric value / nothing to compare against): the period governs
+    if ((this->m_attributes & NOTIFY_ATTR_VALUE) == 0 || have_value == false || this->m_last_value_valid == false) {
+        return true;
+    }
+
+    // gt/lt: notify when the value crosses a threshold
+    if ((this->m_attributes & NOTIFY_ATTR_GT) != 0 && ((this->m_last_value > this->m_gt) != (value > this->m_gt))) {
+        return true;
+    }
+    if ((this->m_attributes & NOTIFY_ATTR_LT) != 0 && ((this->m_last_value < this->m_lt) != (value < this->m_lt))) {
+        return true;
+    }
+
+    // st: notify when the value has moved by at least st
+    if ((this->m_attributes & NOTIFY_ATTR_ST) != 0) {
+        float delta = value - this->m_last_value;
+        if (delta < 0) delta = -delta;
+        if (delta >= this->m_st) {
+            return true;
+        }
+    }
+
+    // no criteria met
+    return false;
+}
+
+// numeric payloads of our content format use the LwM2M binary encoding?
+bool DynamicResource::binaryContent() {
+    return (this->m_content_format == BINARY_CONTENT_FORMAT);
+}
+
+// decode an integer payload: the LwM2M binary encoding, or text (a fractional part is truncated, clamped to the int range)
+bool DynamicResource::decodeInteger(const uint8_t *data,int data_length,int &value,bool binary) {
+    float fvalue = 0.0;
+    if (binary == true) {
+        return DynamicResource::parseBinaryInteger(data,data_length,value);
+    }
+    if (DynamicResource::parseTextInteger(data,data_length,value) == true) {
+        return true;
+    }
+    if (DynamicResource::parseTextFloat(data,data_length,fvalue) == false) {
+        return false;
+    }
+    if (fvalue != fvalue || fvalue > FLT_MAX || fvalue < -FLT_MAX) {
+        // NaN or infinite
+        return false;
+    }
+    // clamp before the conversion (out of range float to int conversions are undefined)
+    if (fvalue >= 2147483648.0f) value = INT_MAX;
+    else if (fvalue <= -2147483648.0f) value = INT_MIN;
+    else value = (int)fvalue;
+    return true;
+}
+
+// decode a float payload: the LwM2M binary encoding, or text
+bool DynamicResource::decodeFloat(const uint8_t *data,int data_length,float &value,bool binary) {
+    if (binary == true) {
+        return DynamicResource::parseBinaryFloat(data,data_length,value);
+    }
+    return DynamicResource::parseTextFloat(data,data_length,value);
+}
+
+// length of a text payload once trailing NULs/whitespace are dropped
+int DynamicResource::textLength(const uint8_t *data,int data_length) {
+    while (data_length > 0 && (data[data_length-1] == '\0' || isspace(data[data_length-1]))) {
+        --data_length;
+    }
+    return data_length;
+}
+
+// parse a (non null terminated) text integer payload (clamped to the int range)
+bool DynamicResource::parseTextInteger(const uint8_t *data,int data_length,int &value) {
+    int length = DynamicResource::textLength(data,data_length);
+    int i = 0;
+    bool negative = false;
+    int64_t accum = 0;
+    if (length <= 0) {
+        return false;
+    }
+    if (data[0] == '-' || data[0] == '+') {
+        negative = (data[0] == '-');
+        ++i;
+    }
+    if (i >= length) {
+        return false;
+    }
+    for (; i < length; ++i) {
+        if (data[i] < '0' || data[i] > '9') {
+            return false;
+        }
+        if (accum <= (int64_t)INT_MAX + 1) {
+            accum = (accum * 10) + (data[i] - '0');
+        }
+    }
+    if (negative) accum = -accum;
+    if (accum > INT_MAX) accum = INT_MAX;
+    if (accum < INT_MIN) accum = INT_MIN;
+    value = (int)accum;
+    return true;
+}
+
+// parse a (non null terminated) text float payload
+bool DynamicResource::parseTextFloat(const uint8_t *data,int data_length,float &value) {
+    char buf[MAX_NUMERIC_TEXT_LENGTH+1];
+    int length = DynamicResource::textLength(data,data_length);
+    if (length <= 0 || length > MAX_NUMERIC_TEXT_LENGTH) {
+        return false;
     }
+    memcpy(buf,data,length);
+    buf[length] = '\0';
+    char *end = NULL;
+    double parsed = strtod(buf,&end);
+    if (end != buf + length) {
+        return false;
+    }
+    value = (float)parsed;
+    return true;
+}
+
+// parse a LwM2M binary integer payload (big-endian two's complement, 1/2/4/8 bytes, clamped to the int range)
+bool DynamicResource::parseBinaryInteger(const uint8_t *data,int data_length,int &value) {
+    if (data == NULL || (data_length != 1 && data_length != 2 && data_length != 4 && data_length != 8)) {
+        return false;
+    }
+    uint64_t raw = 0;
+    for (int i = 0; i < data_length; ++i) {
+        raw = (raw << 8) | data[i];
+    }
+    int shift = 64 - (8 * data_length);
+    int64_t accum = (shift > 0) ? (((int64_t)(raw << shift)) >> shift) : (int64_t)raw;
+    if (accum > INT_MAX) accum = INT_MAX;
+    if (accum < INT_MIN) accum = INT_MIN;
+    value = (int)accum;
+    return true;
+}
+
+// parse a LwM2M binary float payload (big-endian IEEE754, 4/8 bytes)
+bool DynamicResource::parseBinaryFloat(const uint8_t *data,int data_length,float &value) {
+    if (data == NULL || (data_length != 4 && data_length != 8)) {
+        return false;
+    }
+    uint64_t raw = 0;
+    for (int i = 0; i < data_length; ++i) {
+        raw = (raw << 8) | data[i];
+    }
+    if (data_length == 4) {
+        uint32_t raw32 = (uint32_t)raw;
+        float f = 0.0;
+        memcpy(&f,&raw32,sizeof(f));
+        value = f;
+    }
+    else {
+        double d = 0.0;
+        memcpy(&d,&raw,sizeof(d));
+        value = (float)d;
+    }
+    return true;
+}
+
+// set the minimum period
+void DynamicResource::setMinimumPeriod(uint32_t pmin_ms) {
+    this->m_pmin_ms = pmin_ms;
+    if (pmin_ms > 0) this->m_attributes |= NOTIFY_ATTR_PMIN;
+    else this->m_attributes &= ~NOTIFY_ATTR_PMIN;
+}
+
+// set the maximum period
+void DynamicResource::setMaximumPeriod(uint32_t pmax_ms) {
+    this->m_pmax_ms = pmax_ms;
+    if (pmax_ms > 0) this->m_attributes |= NOTIFY_ATTR_PMAX;
+    else this->m_attributes &= ~NOTIFY_ATTR_PMAX;
+}
+
+// set the greater-than threshold
+void DynamicResource::setGreaterThan(float gt) {
+    this->m_gt = gt;
+    this->m_attributes |= NOTIFY_ATTR_GT;
+}
+
+// set the less-than threshold
+void DynamicResource::setLessThan(float lt) {
+    this->m_lt = lt;
+    this->m_attributes |= NOTIFY_ATTR_LT;
+}
+
+// set the step
+void DynamicResource::setStep(float st) {
+    this->m_st = st;
+    this->m_attributes |= NOTIFY_ATTR_ST;
+}
+
+// clear the notification attributes
+void DynamicResource::clearNotificationAttributes() {
+    this->m_attributes = 0;
+    this->m_pmin_ms = 0;
+    this->m_pmax_ms = 0;
+    this->m_gt = 0.0;
+    this->m_lt = 0.0;
+    this->m_st = 0.0;
+    this->m_notified = false;
+    this->m_last_notify_ms = 0;
+    this->m_last_value_valid = false;
+    this->m_last_value = 0.0;
+    this->m_change_pending = false;
+}
+
+// enable/disable change suppression
+void DynamicResource::setChangeSuppression(bool enable,uint32_t force_refresh_periods) {
+    this->m_suppress_unchanged = enable;
+    this->m_force_refresh_periods = force_refresh_periods;
+    this->m_periods_since_emit = 0;
+    this->m_last_hash = 0;
+    this->m_last_length = -1;
+}
+
+// hash of an observed value (32-bit FNV-1a) used for change detection
+uint32_t DynamicResource::hashValue(const uint8_t *data,int data_length) {
+    uint32_t hash = 2166136261U;
+    for (int i = 0; data != NULL && i < data_length; ++i) {
+        hash ^= (uint32_t)data[i];
+        hash *= 16777619U;
+    }
+    return hash;
 }
 
 // set the observer pointer
@@ -379,7 +841,7 @@ string DynamicResource::coapDataToString(uint8_t *coap_data_ptr,int coap_data_pt
             int length = coap_data_ptr_length;
             if (length > MAX_VALUE_BUFFER_LENGTH) {
             	length = MAX_VALUE_BUFFER_LENGTH;
-            	this->logger()->log("DynamicResource::coapDataToString: WARNING clipped data: %d bytes to %d bytes. Increase MAX_VALUE_BUFFER_LENGTH",
+            	LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"DynamicResource::coapDataToString: WARNING clipped data: %d bytes to %d bytes. Increase MAX_VALUE_BUFFER_LENGTH",
             					    coap_data_ptr_length,length);
             }
             memcpy(buf,(char *)coap_data_ptr,length);
@@ -393,14 +855,19 @@ string DynamicResource::coapDataToString(uint8_t *coap_data_ptr,int coap_data_pt
 int DynamicResource::coapDataToInteger(uint8_t *coap_data_ptr,int coap_data_ptr_length) {
 	int value = 0;
 	if (coap_data_ptr != NULL && coap_data_ptr_length > 0) {
+        const uint8_t *data = coap_data_ptr;
+        int data_length = coap_data_ptr_length;
         if (this->getDataWrapper() != NULL) {
             // unwrap the data...
             this->getDataWrapper()->unwrap(coap_data_ptr,coap_data_ptr_length);
-            //value = (int)this->getDataWrapper()->get();                  // assumes data is null terminated in DataWrapper...
+            data = this->getDataWrapper()->get();
+            data_length = this->getDataWrapper()->length();
         }
-        else {
-            // no unwrap of the data...
-            //value = (int)coap_data_ptr;
+
+        // decode
+        if (DynamicResource::decodeInteger(data,data_length,value,this->binaryContent()) == false) {
+            LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"DynamicResource::coapDataToInteger: WARNING unable to decode %d byte payload",data_length);
+            value = 0;
         }
     }
     return value;
@@ -410,14 +877,19 @@ int DynamicResource::coapDataToInteger(uint8_t *coap_data_ptr,int coap_data_ptr_
 float DynamicResource::coapDataToFloat(uint8_t *coap_data_ptr,int coap_data_ptr_length) {
 	float value = 0.0;
 	if (coap_data_ptr != NULL && coap_data_ptr_length > 0) {
+        const uint8_t *data = coap_data_ptr;
+        int data_length = coap_data_ptr_length;
         if (this->getDataWrapper() != NULL) {
             // unwrap the data...
             this->getDataWrapper()->unwrap(coap_data_ptr,coap_data_ptr_length);
-            //value = (float)this->getDataWrapper()->get();                  // assumes data is null terminated in DataWrapper...
+            data = this->getDataWrapper()->get();
+            data_length = this->getDataWrapper()->length();
         }
-        else {
-            // no unwrap of the data...
-            //value = (float)coap_data_ptr;
+
+        // decode
+        if (DynamicResource::decodeFloat(data,data_length,value,this->binaryContent()) == false) {
+            LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"DynamicResource::coapDataToFloat: WARNING unable to decode %d byte payload",data_length);
+            value = 0.0;
         }
     }
     return value;
@@ -452,7 +924,7 @@ bool DynamicResource::isConnected() {
 		}
 	}
 	else {
-		this->logger()->log("DynamicResource::isConnected = false (no endpoint)");
+		LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"DynamicResource::isConnected = false (no endpoint)");
 	}
 	
 	// return our endpoint connection state
@@ -476,7 +948,7 @@ bool DynamicResource::isRegistered() {
 			}
 		}
 		else {
-			this->logger()->log("DynamicResource::isRegistered = false (no endpoint)");
+			LOG_WARN(this->logger(),LOGGER_MODULE_RESOURCE,"DynamicResource::isRegistered = false (no endpoint)");
 		}
 	}
 	
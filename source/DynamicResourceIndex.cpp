@@ -0,0 +1,185 @@
+/**
+ * @file    DynamicResourceIndex.cpp
+ * @brief   mbed CoAP Endpoint M2MBase to DynamicResource dispatch index
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/DynamicResourceIndex.h"
+
+ // constructor
+ DynamicResourceIndex::DynamicResourceIndex() {
+     this->m_keys = NULL;
+     this->m_values = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+ }
+
+ // copy constructor
+ DynamicResourceIndex::DynamicResourceIndex(const DynamicResourceIndex &index) {
+     this->m_keys = NULL;
+     this->m_values = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+     if (index.m_capacity > 0) {
+         this->m_keys = (const void **)calloc(index.m_capacity,sizeof(void *));
+         this->m_values = (DynamicResource **)calloc(index.m_capacity,sizeof(DynamicResource *));
+         if (this->m_keys != NULL && this->m_values != NULL) {
+             memcpy(this->m_keys,index.m_keys,index.m_capacity*sizeof(void *));
+             memcpy(this->m_values,index.m_values,index.m_capacity*sizeof(DynamicResource *));
+             this->m_capacity = index.m_capacity;
+             this->m_size = index.m_size;
+         }
+         else {
+             // unable to allocate... the copy is left unbuilt
+             this->clear();
+         }
+     }
+ }
+
+ // assignment (copy and swap: the argument is our deep copy, our old tables are freed with it)
+ DynamicResourceIndex &DynamicResourceIndex::operator=(DynamicResourceIndex index) {
+     this->swap(index);
+     return *this;
+ }
+
+ // exchange tables with another index
+ void DynamicResourceIndex::swap(DynamicResourceIndex &index) {
+     const void **keys = this->m_keys;
+     DynamicResource **values = this->m_values;
+     int capacity = this->m_capacity;
+     int size = this->m_size;
+     this->m_keys = index.m_keys;
+     this->m_values = index.m_values;
+     this->m_capacity = index.m_capacity;
+     this->m_size = index.m_size;
+     index.m_keys = keys;
+     index.m_values = values;
+     index.m_capacity = capacity;
+     index.m_size = size;
+ }
+
+ // destructor
+ DynamicResourceIndex::~DynamicResourceIndex() {
+     this->clear();
+ }
+
+ // clear the index
+ void DynamicResourceIndex::clear() {
+     if (this->m_keys != NULL) free(this->m_keys);
+     if (this->m_values != NULL) free(this->m_values);
+     this->m_keys = NULL;
+     this->m_values = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+ }
+
+ // (re)build the index
+ void DynamicResourceIndex::build(const vector<DynamicResource *> *resources) {
+     this->clear();
+     if (resources != NULL) {
+         // keep the load factor at or below 50% so that probe sequences stay short
+         int capacity = 8;
+         while (capacity < (2 * (int)resources->size())) {
+             capacity <<= 1;
+         }
+         if (this->resize(capacity) == false) {
+             // unable to allocate... lookups will simply miss
+             return;
+         }
+         for (int i = 0; i < (int)resources->size(); ++i) {
+             DynamicResource *res = resources->at(i);
+             if (res != NULL && res->getResource() != NULL) {
+                 this->insert((const void *)res->getResource(),res);
+             }
+         }
+     }
+ }
+
+ // index a bound resource
+ bool DynamicResourceIndex::add(DynamicResource *resource) {
+     if (resource == NULL || resource->getResource() == NULL) {
+         return false;
+     }
+
+     // keep the load factor at or below 50% (doubling... the table is rehashed)
+     if (2 * (this->m_size + 1) > this->m_capacity) {
+         int capacity = (this->m_capacity > 0) ? (2 * this->m_capacity) : 8;
+         if (this->resize(capacity) == false) {
+             // unable to allocate... the index is left as it was
+             return false;
+         }
+     }
+     this->insert((const void *)resource->getResource(),resource);
+     return true;
+ }
+
+ // lookup the DynamicResource for a given M2MBase instance
+ DynamicResource *DynamicResourceIndex::lookup(const void *base) {
+     if (base != NULL && this->m_capacity > 0) {
+         int mask = this->m_capacity - 1;
+         for (int i = this->slot(base); this->m_keys[i] != NULL; i = (i + 1) & mask) {
+             if (this->m_keys[i] == base) {
+                 return this->m_values[i];
+             }
+         }
+     }
+     return NULL;
+ }
+
+ // insert into the index (open addressing, linear probing)
+ void DynamicResourceIndex::insert(const void *key,DynamicResource *value) {
+     int mask = this->m_capacity - 1;
+     int i = this->slot(key);
+     while (this->m_keys[i] != NULL && this->m_keys[i] != key) {
+         i = (i + 1) & mask;
+     }
+     if (this->m_keys[i] == NULL) {
+         ++this->m_size;
+     }
+     this->m_keys[i] = key;
+     this->m_values[i] = value;
+ }
+
+ // move the entries into tables of a given capacity (power of 2)
+ bool DynamicResourceIndex::resize(int capacity) {
+     DynamicResourceIndex resized;
+     resized.m_keys = (const void **)calloc(capacity,sizeof(void *));
+     resized.m_values = (DynamicResource **)calloc(capacity,sizeof(DynamicResource *));
+     if (resized.m_keys == NULL || resized.m_values == NULL) {
+         return false;
+     }
+     resized.m_capacity = capacity;
+     for (int i = 0; i < this->m_capacity; ++i) {
+         if (this->m_keys[i] != NULL) {
+             resized.insert(this->m_keys[i],this->m_values[i]);
+         }
+     }
+
+     // our old tables are freed with resized
+     this->swap(resized);
+     return true;
+ }
+
+ // home slot for a given key (Fibonacci hash of the pointer value)
+ int DynamicResourceIndex::slot(const void *key) {
+     uint32_t h = (uint32_t)(((uintptr_t)key) >> 2) * 2654435761U;
+     h ^= (h >> 16);
+     return (int)(h & (uint32_t)(this->m_capacity - 1));
+ }
@@ -25,54 +25,63 @@
  
  #ifdef CONNECTOR_USING_EVENT_QUEUES
  
- // our instance
- static void *_instance = NULL;
+ // the shared EventQueue and its dispatch thread
+ static EventQueue *_event_queue = NULL;
+ static Thread *_event_queue_thread = NULL;
+ 
+ // get the shared EventQueue (created and dispatched on first use)
+ EventQueue *EventQueueResourceObserver::sharedEventQueue() {
+     if (_event_queue == NULL) {
+         _event_queue = new EventQueue(EVENT_QUEUE_OBSERVER_EVENTS * EVENTS_EVENT_SIZE);
+         _event_queue_thread = new Thread(osPriorityNormal,EVENT_QUEUE_OBSERVER_STACK_SIZE);
+         _event_queue_thread->start(callback(_event_queue,&EventQueue::dispatch_forever));
+     }
+     return _event_queue;
+ }
  
  // constructor
- EventQueueResourceObserver::EventQueueResourceObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,sleep_time), m_event_queue() {
+ EventQueueResourceObserver::EventQueueResourceObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,sleep_time) {
         // default is not observing...
         this->setObserving(false);
+        this->m_id = 0;
         
         // DEBUG
-        this->logger()->log("EventQueueResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
-        
-        // our instance
-        _instance = (void *)this;
-        
-        // start the thread by invoking the thread task...
-        this->m_id = this->m_event_queue.call_every(sleep_time,EventQueueResourceObserver::observation_task);
+        LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"EventQueueResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
  }
  
  // destructor
  EventQueueResourceObserver::~EventQueueResourceObserver() {
      this->stopObservation();
-     this->m_event_queue.cancel(this->m_id);
  }
  
  // observation task method
  void EventQueueResourceObserver::observation_task() {
-     EventQueueResourceObserver *me = (EventQueueResourceObserver *)_instance;
-     if (me != NULL && me->isObserving() == true && me->getResource() != NULL) {
-         DynamicResource *res = me->getResource();
-         if (res != NULL && res->isRegistered() == true) {
-             res->observe();
-         }
-     }
+     this->observeResource(0);
  }
 
  // begin observing...
  void EventQueueResourceObserver::beginObservation() {
-     this->setObserving(true);
+     if (this->m_id == 0 && this->getSleepTime() > 0) {
+         this->m_id = EventQueueResourceObserver::sharedEventQueue()->call_every(this->getSleepTime(),callback(this,&EventQueueResourceObserver::observation_task));
+         if (this->m_id == 0) {
+             LOG_ERROR(this->logger(),LOGGER_MODULE_OBSERVER,"EventQueueResourceObserver: ERROR unable to schedule %s (increase EVENT_QUEUE_OBSERVER_EVENTS)",this->getResource()->getFullName().c_str());
+         }
+     }
+     this->setObserving(this->m_id != 0);
  }
  
  // stop observing...
  void EventQueueResourceObserver::stopObservation() {
      this->setObserving(false);
+     if (this->m_id != 0) {
+         EventQueueResourceObserver::sharedEventQueue()->cancel(this->m_id);
+         this->m_id = 0;
+     }
  }
  
  // halt the underlying observer mechanism
  void EventQueueResourceObserver::halt() {
-     this->m_event_queue.cancel(this->m_id);
+     this->stopObservation();
  }
  
  #endif // CONNECTOR_USING_EVENT_QUEUES
\ No newline at end of file
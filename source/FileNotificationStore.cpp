@@ -0,0 +1,149 @@
+/**
+ * @file    FileNotificationStore.cpp
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue (file backend)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/FileNotificationStore.h"
+
+ // file header: [magic:32][capacity:32][head:32][tail:32][used:32][count:32][dropped:32] (little endian)
+ #define FILE_NOTIFICATION_STORE_MAGIC          0x4E53544FU         // "NSTO"
+ #define FILE_NOTIFICATION_STORE_HEADER_FIELDS  7
+ #define FILE_NOTIFICATION_STORE_HEADER_LENGTH  (4 * FILE_NOTIFICATION_STORE_HEADER_FIELDS)
+
+ // constructor
+ FileNotificationStore::FileNotificationStore(const char *path,uint32_t capacity) : NotificationStore(capacity) {
+     memset(this->m_path,0,sizeof(this->m_path));
+     if (path != NULL) {
+         strncpy(this->m_path,path,NOTIFICATION_STORE_PATH_LENGTH);
+     }
+     this->m_file = NULL;
+ }
+
+ // destructor
+ FileNotificationStore::~FileNotificationStore() {
+     this->close();
+ }
+
+ // open the store
+ bool FileNotificationStore::open() {
+     if (this->m_file != NULL) {
+         return true;
+     }
+     if (NotificationStore::open() == false || strlen(this->m_path) == 0) {
+         return false;
+     }
+     this->m_mutex.lock();
+     this->m_file = fopen(this->m_path,"r+b");
+     if (this->m_file == NULL || this->loadState() == false) {
+         // no (usable) previous store... start a new one
+         if (this->m_file != NULL) {
+             fclose(this->m_file);
+         }
+         this->m_file = fopen(this->m_path,"w+b");
+         this->m_head = 0;
+         this->m_tail = 0;
+         this->m_used = 0;
+         this->m_count = 0;
+         this->m_dropped = 0;
+         if (this->m_file != NULL && this->saveState() == false) {
+             fclose(this->m_file);
+             this->m_file = NULL;
+         }
+     }
+     this->m_mutex.unlock();
+     return this->m_file != NULL;
+ }
+
+ // close the file
+ void FileNotificationStore::close() {
+     this->m_mutex.lock();
+     if (this->m_file != NULL) {
+         fclose(this->m_file);
+         this->m_file = NULL;
+     }
+     this->m_mutex.unlock();
+ }
+
+ // read from the record area
+ bool FileNotificationStore::readAt(uint32_t offset,uint8_t *buffer,uint32_t length) {
+     if (this->m_file == NULL || fseek(this->m_file,(long)(FILE_NOTIFICATION_STORE_HEADER_LENGTH + offset),SEEK_SET) != 0) {
+         return false;
+     }
+     return fread(buffer,1,length,this->m_file) == length;
+ }
+
+ // write to the record area
+ bool FileNotificationStore::writeAt(uint32_t offset,const uint8_t *buffer,uint32_t length) {
+     if (this->m_file == NULL || fseek(this->m_file,(long)(FILE_NOTIFICATION_STORE_HEADER_LENGTH + offset),SEEK_SET) != 0) {
+         return false;
+     }
+     return fwrite(buffer,1,length,this->m_file) == length;
+ }
+
+ // persist the ring state (mutex held)
+ bool FileNotificationStore::saveState() {
+     uint32_t fields[FILE_NOTIFICATION_STORE_HEADER_FIELDS] = { FILE_NOTIFICATION_STORE_MAGIC,this->m_capacity,this->m_head,this->m_tail,this->m_used,this->m_count,this->m_dropped };
+     uint8_t header[FILE_NOTIFICATION_STORE_HEADER_LENGTH];
+     for (int i = 0; i < FILE_NOTIFICATION_STORE_HEADER_FIELDS; ++i) {
+         for (int j = 0; j < 4; ++j) {
+             header[(4 * i) + j] = (uint8_t)((fields[i] >> (8 * j)) & 0xFF);
+         }
+     }
+     if (this->m_file == NULL || fseek(this->m_file,0,SEEK_SET) != 0) {
+         return false;
+     }
+     if (fwrite(header,1,sizeof(header),this->m_file) != sizeof(header)) {
+         return false;
+     }
+     return fflush(this->m_file) == 0;
+ }
+
+ // restore the ring state (mutex held)
+ bool FileNotificationStore::loadState() {
+     uint32_t fields[FILE_NOTIFICATION_STORE_HEADER_FIELDS];
+     uint8_t header[FILE_NOTIFICATION_STORE_HEADER_LENGTH];
+     if (fseek(this->m_file,0,SEEK_SET) != 0 || fread(header,1,sizeof(header),this->m_file) != sizeof(header)) {
+         return false;
+     }
+     for (int i = 0; i < FILE_NOTIFICATION_STORE_HEADER_FIELDS; ++i) {
+         fields[i] = 0;
+         for (int j = 0; j < 4; ++j) {
+             fields[i] |= ((uint32_t)header[(4 * i) + j]) << (8 * j);
+         }
+     }
+
+     // must be ours, with the same geometry and a consistent state
+     if (fields[0] != FILE_NOTIFICATION_STORE_MAGIC || fields[1] != this->m_capacity) {
+         return false;
+     }
+     if (fields[2] >= this->m_capacity || fields[3] >= this->m_capacity || fields[4] > this->m_capacity) {
+         return false;
+     }
+     if (((fields[3] + fields[4]) % this->m_capacity) != fields[2]) {
+         return false;
+     }
+     this->m_head = fields[2];
+     this->m_tail = fields[3];
+     this->m_used = fields[4];
+     this->m_count = fields[5];
+     this->m_dropped = fields[6];
+     return true;
+ }
@@ -0,0 +1,203 @@
+/**
+ * @file    IdentifierTable.cpp
+ * @brief   mbed CoAP Endpoint shared object/resource identifier table
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/IdentifierTable.h"
+
+ // initial hash capacity (doubled whenever the table becomes half full)
+ #define IDENTIFIER_HASH_INITIAL_CAPACITY   32
+
+ // shared instance
+ static IdentifierTable * volatile _identifier_table = NULL;
+
+ // get the shared identifier table (resources may be created from several threads, or during static construction)
+ IdentifierTable *IdentifierTable::instance() {
+     IdentifierTable *table = _identifier_table;
+     if (table == NULL) {
+         IdentifierTable *created = new IdentifierTable();
+         void *expected = NULL;
+         if (core_util_atomic_cas_ptr((void * volatile *)&_identifier_table,&expected,created) == false) {
+             // another thread won the race... use its table
+             delete created;
+         }
+         table = _identifier_table;
+     }
+     return table;
+ }
+
+ // constructor
+ IdentifierTable::IdentifierTable() : m_mutex(), m_strings() {
+     this->m_hash = NULL;
+     this->m_hash_capacity = 0;
+ }
+
+ // hash an identifier (FNV-1a)
+ uint32_t IdentifierTable::hashOf(const char *name) {
+     uint32_t hash = 2166136261UL;
+     while (*name != '\0') {
+         hash ^= (uint8_t)*name++;
+         hash *= 16777619UL;
+     }
+     return hash;
+ }
+
+ // grow (or create) the hash and re-insert the interned strings (mutex held)
+ bool IdentifierTable::growHash() {
+     int capacity = (this->m_hash_capacity > 0) ? (this->m_hash_capacity * 2) : IDENTIFIER_HASH_INITIAL_CAPACITY;
+     int *hash = (int *)malloc(capacity * sizeof(int));
+     if (hash == NULL) {
+         return false;
+     }
+     for (int i = 0; i < capacity; ++i) {
+         hash[i] = -1;
+     }
+     for (int i = 0; i < (int)this->m_strings.size(); ++i) {
+         uint32_t slot = IdentifierTable::hashOf(this->m_strings[i]->c_str()) & (capacity - 1);
+         while (hash[slot] >= 0) {
+             slot = (slot + 1) & (capacity - 1);
+         }
+         hash[slot] = i;
+     }
+     free(this->m_hash);
+     this->m_hash = hash;
+     this->m_hash_capacity = capacity;
+     return true;
+ }
+
+ // get the handle for an identifier
+ IdentifierHandle IdentifierTable::intern(const char *name) {
+     if (name == NULL) {
+         return IDENTIFIER_INVALID;
+     }
+
+     // numeric (no sign, no leading zeros so that the text round trips)
+     int length = (int)strlen(name);
+     bool numeric = (length > 0 && length <= IDENTIFIER_MAX_DIGITS && (name[0] != '0' || length == 1));
+     uint32_t value = 0;
+     for (int i = 0; numeric == true && i < length; ++i) {
+         if (name[i] < '0' || name[i] > '9') {
+             numeric = false;
+         }
+         else {
+             value = (value * 10) + (uint32_t)(name[i] - '0');
+         }
+     }
+     if (numeric == true) {
+         return (IdentifierHandle)value;
+     }
+     return this->internString(name);
+ }
+
+ // get the (interned string) handle for an identifier
+ IdentifierHandle IdentifierTable::internString(const char *name) {
+     if (name == NULL) {
+         return IDENTIFIER_INVALID;
+     }
+     this->m_mutex.lock();
+     IdentifierHandle handle = this->internLocked(name);
+     this->m_mutex.unlock();
+     return handle;
+ }
+
+ // intern a string (mutex held: identifiers are interned when resources are created, not on the request path)
+ IdentifierHandle IdentifierTable::internLocked(const char *name) {
+     // keep the hash at most half full
+     if ((int)(this->m_strings.size() + 1) * 2 > this->m_hash_capacity && this->growHash() == false) {
+         return IDENTIFIER_INVALID;
+     }
+
+     // probe for the name (or the empty slot it will occupy)
+     uint32_t slot = IdentifierTable::hashOf(name) & (this->m_hash_capacity - 1);
+     while (this->m_hash[slot] >= 0) {
+         if (strcmp(this->m_strings[this->m_hash[slot]]->c_str(),name) == 0) {
+             return IDENTIFIER_INTERNED_FLAG | (IdentifierHandle)this->m_hash[slot];
+         }
+         slot = (slot + 1) & (this->m_hash_capacity - 1);
+     }
+
+     // new identifier
+     string *copy = new string(name);
+     if (copy == NULL) {
+         return IDENTIFIER_INVALID;
+     }
+     this->m_strings.push_back(copy);
+     this->m_hash[slot] = (int)(this->m_strings.size() - 1);
+     return IDENTIFIER_INTERNED_FLAG | (IdentifierHandle)this->m_hash[slot];
+ }
+
+ // get the interned string for a handle
+ const char *IdentifierTable::str(IdentifierHandle handle) {
+     const char *result = NULL;
+     if (handle != IDENTIFIER_INVALID && IdentifierTable::isNumeric(handle) == false) {
+         int index = (int)(handle & ~IDENTIFIER_INTERNED_FLAG);
+         this->m_mutex.lock();
+         if (index < (int)this->m_strings.size()) {
+             result = this->m_strings[index]->c_str();
+         }
+         this->m_mutex.unlock();
+     }
+     return result;
+ }
+
+ // render any handle as text
+ const char *IdentifierTable::toString(IdentifierHandle handle,char *buffer,int buffer_length) {
+     if (IdentifierTable::isNumeric(handle) == true) {
+         snprintf(buffer,buffer_length,"%lu",(unsigned long)handle);
+         return buffer;
+     }
+     const char *result = this->str(handle);
+     return (result != NULL) ? result : "";
+ }
+
+ // render any handle as a string
+ string IdentifierTable::toString(IdentifierHandle handle) {
+     char buffer[IDENTIFIER_MAX_DIGITS+2];
+     return string(this->toString(handle,buffer,sizeof(buffer)));
+ }
+
+ // get the (shared) string for any handle
+ const string &IdentifierTable::name(IdentifierHandle handle) {
+     static const string empty;
+     char buffer[IDENTIFIER_MAX_DIGITS+2];
+     IdentifierHandle interned = handle;
+     if (handle == IDENTIFIER_INVALID) {
+         return empty;
+     }
+     this->m_mutex.lock();
+     if (IdentifierTable::isNumeric(handle) == true) {
+         // numeric identifiers share the string table (the handle itself stays numeric)
+         snprintf(buffer,sizeof(buffer),"%lu",(unsigned long)handle);
+         interned = this->internLocked(buffer);
+     }
+     int index = (int)(interned & ~IDENTIFIER_INTERNED_FLAG);
+     const string *result = (interned != IDENTIFIER_INVALID && index < (int)this->m_strings.size()) ? this->m_strings[index] : &empty;
+     this->m_mutex.unlock();
+     return *result;
+ }
+
+ // number of interned strings
+ int IdentifierTable::size() {
+     this->m_mutex.lock();
+     int size = (int)this->m_strings.size();
+     this->m_mutex.unlock();
+     return size;
+ }
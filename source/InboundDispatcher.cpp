@@ -0,0 +1,285 @@
+/**
+ * @file    InboundDispatcher.cpp
+ * @brief   mbed CoAP Endpoint asynchronous inbound request dispatcher
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/InboundDispatcher.h"
+
+ // constructor
+ InboundDispatcher::InboundDispatcher(const Logger *logger,int depth,OverflowPolicy policy) : m_mutex(), m_pending(0), m_thread(osPriorityNormal,INBOUND_DISPATCH_STACK_SIZE) {
+     this->m_logger = (Logger *)logger;
+     this->m_depth = (depth > 0) ? depth : DEFAULT_INBOUND_DISPATCH_DEPTH;
+     this->m_policy = policy;
+     this->m_head = 0;
+     this->m_count = 0;
+     this->m_running = false;
+     this->m_stop = false;
+     this->m_queue = (Request *)calloc(this->m_depth,sizeof(Request));
+     this->resetStatistics();
+ }
+
+ // destructor
+ InboundDispatcher::~InboundDispatcher() {
+     this->halt();
+     if (this->m_queue != NULL) free(this->m_queue);
+ }
+
+ // start the worker thread
+ bool InboundDispatcher::start() {
+     if (this->m_running == false && this->m_queue != NULL) {
+         if (this->m_thread.start(callback(this,&InboundDispatcher::dispatch_task)) == osOK) {
+             this->m_mutex.lock();
+             this->m_running = true;
+             this->m_mutex.unlock();
+             LOG_INFO(this->logger(),LOGGER_MODULE_ENDPOINT,"InboundDispatcher: started (depth: %d policy: %d)",this->m_depth,(int)this->m_policy);
+         }
+         else {
+             LOG_ERROR(this->logger(),LOGGER_MODULE_ENDPOINT,"InboundDispatcher: ERROR unable to start worker thread");
+         }
+     }
+     return this->m_running;
+ }
+
+ // halt the worker thread
+ void InboundDispatcher::halt() {
+     // new requests are processed inline from here on (dispatch() checks m_running and enqueues under m_mutex)
+     this->m_mutex.lock();
+     bool running = this->m_running;
+     this->m_running = false;
+     this->m_mutex.unlock();
+     if (running == true) {
+         // stop and wait for the worker
+         this->m_stop = true;
+         this->m_pending.release();
+         this->m_thread.join();
+
+         // discard anything queued before we stopped (nothing can be queued after)
+         this->m_mutex.lock();
+         while (this->m_count > 0) {
+             Request *request = &this->m_queue[this->m_head];
+             ++this->m_stats[this->classify(request->op)].dropped;
+             this->discard(request);
+             this->m_head = (this->m_head + 1) % this->m_depth;
+             --this->m_count;
+         }
+         this->m_mutex.unlock();
+     }
+ }
+
+ // dispatch an inbound operation
+ bool InboundDispatcher::dispatch(DynamicResource *resource,M2MBase::Operation op,M2MBase::BaseType type) {
+     if (resource == NULL) {
+         return false;
+     }
+
+     // the resource value may be overwritten by a later request before ours is processed... take a copy now
+     Request request = { resource, op, type, 0, NULL, 0 };
+     if (this->snapshot(&request) == false) {
+         LOG_WARN(this->logger(),LOGGER_MODULE_ENDPOINT,"InboundDispatcher: unable to copy request payload... processing inline");
+         request.enqueued_us = us_ticker_read();
+         this->execute(request,request.enqueued_us);
+         return true;
+     }
+
+     OperationClass op_class = this->classify(op);
+     bool process_inline = false;
+     bool signal = false;
+
+     this->m_mutex.lock();
+     if (this->m_running == false) {
+         // no worker (not started, or halted)... process inline
+         process_inline = true;
+     }
+     else if (this->m_count >= this->m_depth) {
+         // queue is full... apply our overflow policy
+         if (this->m_policy == DROP_OLDEST) {
+             // account for the request we are about to discard
+             Request *oldest = &this->m_queue[this->m_head];
+             ++this->m_stats[this->classify(oldest->op)].dropped;
+             this->discard(oldest);
+             this->m_head = (this->m_head + 1) % this->m_depth;
+             --this->m_count;
+         }
+         else if (this->m_policy == PROCESS_INLINE) {
+             ++this->m_stats[op_class].inlined;
+             process_inline = true;
+         }
+         else {
+             ++this->m_stats[op_class].dropped;
+             this->m_mutex.unlock();
+             this->discard(&request);
+             return false;
+         }
+     }
+     else {
+         // the worker is signalled once for each new queue slot that is used
+         signal = true;
+     }
+     if (process_inline == false) {
+         Request *slot = &this->m_queue[(this->m_head + this->m_count) % this->m_depth];
+         *slot = request;
+         slot->enqueued_us = us_ticker_read();
+         ++this->m_count;
+         ++this->m_stats[op_class].queued;
+     }
+     this->m_mutex.unlock();
+
+     if (process_inline == true) {
+         request.enqueued_us = us_ticker_read();
+         this->execute(request,request.enqueued_us);
+         this->discard(&request);
+     }
+     else if (signal == true) {
+         this->m_pending.release();
+     }
+     return true;
+ }
+
+ // worker thread task
+ void InboundDispatcher::dispatch_task() {
+     while(true) {
+         this->m_pending.wait();
+         if (this->m_stop == true) {
+             break;
+         }
+
+         // pull the next request (if a DROP_OLDEST overflow emptied the slot, there may be none)
+         Request request;
+         bool have_request = false;
+         this->m_mutex.lock();
+         if (this->m_count > 0) {
+             request = this->m_queue[this->m_head];
+             this->m_head = (this->m_head + 1) % this->m_depth;
+             --this->m_count;
+             have_request = true;
+         }
+         this->m_mutex.unlock();
+
+         if (have_request == true) {
+             this->execute(request,us_ticker_read());
+             this->discard(&request);
+         }
+     }
+ }
+
+ // execute a request and record its timings
+ void InboundDispatcher::execute(const Request &request,uint32_t dequeued_us) {
+     uint32_t wait_us = dequeued_us - request.enqueued_us;
+     uint32_t start_us = us_ticker_read();
+     if (request.payload != NULL) {
+         request.resource->process(request.op,request.type,request.payload,request.payload_length);
+     }
+     else {
+         request.resource->process(request.op,request.type);
+     }
+     uint32_t exec_us = us_ticker_read() - start_us;
+
+     this->m_mutex.lock();
+     Statistics *stats = &this->m_stats[this->classify(request.op)];
+     ++stats->processed;
+     stats->total_queue_wait_us += wait_us;
+     if (wait_us > stats->max_queue_wait_us) stats->max_queue_wait_us = wait_us;
+     stats->total_exec_us += exec_us;
+     if (exec_us > stats->max_exec_us) stats->max_exec_us = exec_us;
+     this->m_mutex.unlock();
+ }
+
+ // copy the payload that process() will read (PUT/POST/DELETE use the resource value)
+ bool InboundDispatcher::snapshot(Request *request) {
+     M2MResource *res = (M2MResource *)request->resource->getResource();
+     if (res == NULL || (request->op & (M2MBase::PUT_ALLOWED | M2MBase::POST_ALLOWED | M2MBase::DELETE_ALLOWED)) == 0) {
+         return true;
+     }
+     int length = (int)res->value_length();
+     request->payload = (uint8_t *)malloc(length + 1);
+     if (request->payload == NULL) {
+         return false;
+     }
+     if (length > 0) {
+         memcpy(request->payload,res->value(),length);
+     }
+     request->payload[length] = 0;
+     request->payload_length = length;
+     return true;
+ }
+
+ // release a request's payload copy
+ void InboundDispatcher::discard(Request *request) {
+     if (request->payload != NULL) {
+         free(request->payload);
+     }
+     request->payload = NULL;
+     request->payload_length = 0;
+ }
+
+ // get the statistics for an operation class
+ InboundDispatcher::Statistics InboundDispatcher::getStatistics(OperationClass op) {
+     Statistics stats;
+     memset(&stats,0,sizeof(stats));
+     if (op >= 0 && op < OPERATION_NUM_TYPES) {
+         this->m_mutex.lock();
+         stats = this->m_stats[op];
+         this->m_mutex.unlock();
+     }
+     return stats;
+ }
+
+ // reset all statistics
+ void InboundDispatcher::resetStatistics() {
+     this->m_mutex.lock();
+     memset(this->m_stats,0,sizeof(this->m_stats));
+     this->m_mutex.unlock();
+ }
+
+ // log a summary of the statistics
+ void InboundDispatcher::logStatistics() {
+     static const char *names[OPERATION_NUM_TYPES] = { "PUT", "POST", "DELETE", "OTHER" };
+     for(int i=0;i<(int)OPERATION_NUM_TYPES;++i) {
+         Statistics stats = this->getStatistics((OperationClass)i);
+         uint32_t avg_wait_us = (stats.processed > 0) ? (uint32_t)(stats.total_queue_wait_us / stats.processed) : 0;
+         uint32_t avg_exec_us = (stats.processed > 0) ? (uint32_t)(stats.total_exec_us / stats.processed) : 0;
+         this->logger()->log("InboundDispatcher: %s queued: %u processed: %u dropped: %u inlined: %u wait(avg/max): %u/%u us exec(avg/max): %u/%u us",
+                             names[i],(unsigned)stats.queued,(unsigned)stats.processed,(unsigned)stats.dropped,(unsigned)stats.inlined,
+                             (unsigned)avg_wait_us,(unsigned)stats.max_queue_wait_us,(unsigned)avg_exec_us,(unsigned)stats.max_exec_us);
+     }
+ }
+
+ // number of currently queued requests
+ int InboundDispatcher::getPending() {
+     this->m_mutex.lock();
+     int count = this->m_count;
+     this->m_mutex.unlock();
+     return count;
+ }
+
+ // classify an operation for statistics
+ InboundDispatcher::OperationClass InboundDispatcher::classify(M2MBase::Operation op) {
+     // same precedence as DynamicResource::process()
+     if ((op & M2MBase::PUT_ALLOWED) != 0) return OPERATION_PUT;
+     if ((op & M2MBase::POST_ALLOWED) != 0) return OPERATION_POST;
+     if ((op & M2MBase::DELETE_ALLOWED) != 0) return OPERATION_DELETE;
+     return OPERATION_OTHER;
+ }
+
+ // our logger
+ Logger *InboundDispatcher::logger() {
+     return this->m_logger;
+ }
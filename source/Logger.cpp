@@ -23,37 +23,363 @@
 // Class support
 #include "mbed-connector-interface/Logger.h"
 
+// async ring record header: [committed:1][skip:1][unused:14][length:16] followed by the record, padded to 4 bytes
+#define LOGGER_RECORD_COMMITTED     0x80000000
+#define LOGGER_RECORD_SKIP          0x40000000
+#define LOGGER_RECORD_BINARY        0x20000000
+#define LOGGER_RECORD_LENGTH_MASK   0x0000FFFF
+#define LOGGER_RECORD_SIZE(len)     (4 + (((len) + 3) & ~3))
+
+// binary log frame sync bytes (frame: [0xA5][0x5A][length:16 LE][format address:32 LE][raw arguments])
+#define LOGGER_FRAME_SYNC_0         0xA5
+#define LOGGER_FRAME_SYNC_1         0x5A
+
+// dropped record notice (also referenced by address in binary frames)
+static const char s_dropped_format[] = "Logger: %lu log records dropped (async ring full)\r\n";
+
+// append raw bytes to a binary record
+static bool append_bytes(uint8_t *record,int &length,const void *data,int data_length)
+{
+    if (length + data_length > LOGGER_BINARY_RECORD_LENGTH) {
+        return false;
+    }
+    memcpy(&record[length],data,data_length);
+    length += data_length;
+    return true;
+}
+
 // Constructor
 Logger::Logger(const Serial *pc)
 {
     this->m_pc = (Serial *)pc;
+    this->m_level = LOGGER_COMPILE_LEVEL;
+    this->m_modules = LOGGER_MODULE_ALL;
+    this->m_async = NULL;
+    this->m_async_owner = false;
 }
 
 // Copy Constructor
 Logger::Logger(const Logger &logger)
 {
     this->m_pc = logger.m_pc;
+    this->m_level = logger.m_level;
+    this->m_modules = logger.m_modules;
+    this->m_async = logger.m_async;
+    this->m_async_owner = false;
 }
 
 // Destructor
 Logger::~Logger()
 {
+    if (this->m_async != NULL && this->m_async_owner == true) {
+        this->m_async->thread->terminate();
+        delete this->m_async->thread;
+        delete this->m_async->pending;
+        free(this->m_async->ring);
+        free(this->m_async);
+    }
+    this->m_async = NULL;
+}
+
+// switch to asynchronous logging
+bool Logger::startAsync(int ring_length)
+{
+    if (this->m_async != NULL) {
+        return true;
+    }
+    if (this->m_pc == NULL || ring_length < (2 * LOGGER_BUFFER_LENGTH) || ring_length > (LOGGER_RECORD_LENGTH_MASK + 1) || (ring_length & (ring_length - 1)) != 0) {
+        this->log("Logger: unable to start async logging (ring length: %d)",ring_length);
+        return false;
+    }
+    AsyncState *async = (AsyncState *)calloc(1,sizeof(AsyncState));
+    if (async != NULL) {
+        async->ring = (uint8_t *)calloc(ring_length,1);
+    }
+    if (async == NULL || async->ring == NULL) {
+        if (async != NULL) free(async);
+        this->log("Logger: unable to allocate async log ring (%d bytes)",ring_length);
+        return false;
+    }
+    async->ring_length = (uint32_t)ring_length;
+    async->pending = new Semaphore(0);
+    async->thread = new Thread(osPriorityLow,LOGGER_ASYNC_STACK_SIZE);
+
+    // the drain thread uses m_async... publish it before the thread can run
+    this->m_async = async;
+    if (async->thread->start(callback(this,&Logger::drain_task)) != osOK) {
+        this->m_async = NULL;
+        delete async->thread;
+        delete async->pending;
+        free(async->ring);
+        free(async);
+        this->log("Logger: unable to start async log drain thread");
+        return false;
+    }
+    this->m_async_owner = true;
+    return true;
+}
+
+// switch to binary asynchronous logging
+bool Logger::startBinary(int ring_length)
+{
+    if (this->startAsync(ring_length) == true) {
+        this->m_async->binary = true;
+        return true;
+    }
+    return false;
+}
+
+// wait (bounded) for the async ring to drain
+void Logger::flush(int timeout_ms)
+{
+    if (this->m_async != NULL) {
+        while (this->m_async->tail != this->m_async->head && timeout_ms > 0) {
+            this->m_async->pending->release();
+            ThisThread::sleep_for(1);
+            --timeout_ms;
+        }
+    }
+}
+
+// number of dropped async records
+uint32_t Logger::getDroppedCount()
+{
+    return (this->m_async != NULL) ? this->m_async->dropped : 0;
+}
+
+// copy a formatted record into the async ring (lock-free, multiple producers)
+bool Logger::enqueue(const char *data,int length,uint32_t flags)
+{
+    AsyncState *async = this->m_async;
+    uint32_t mask = async->ring_length - 1;
+    uint32_t need = LOGGER_RECORD_SIZE(length);
+    uint32_t head = 0;
+    uint32_t offset = 0;
+    uint32_t total = 0;
+
+    // reserve space: records never wrap, so a record that would cross the end of the ring is preceded by a skip record
+    do {
+        head = async->head;
+        offset = head & mask;
+        total = need;
+        if (offset + need > async->ring_length) {
+            total += (async->ring_length - offset);
+        }
+        if ((head + total) - async->tail > async->ring_length) {
+            core_util_atomic_incr_u32(&async->dropped,1);
+            return false;
+        }
+    } while (core_util_atomic_cas_u32(&async->head,&head,head + total) == false);
+
+    // publish a skip record to the end of the ring if needed
+    if (total != need) {
+        *((volatile uint32_t *)&async->ring[offset]) = LOGGER_RECORD_COMMITTED | LOGGER_RECORD_SKIP | (async->ring_length - offset);
+        offset = 0;
+    }
+
+    // copy the record, then publish its header
+    memcpy(&async->ring[offset + 4],data,length);
+    __DMB();
+    *((volatile uint32_t *)&async->ring[offset]) = LOGGER_RECORD_COMMITTED | flags | (uint32_t)length;
+    return true;
+}
+
+// encode a binary record: [format address:32][raw arguments] - integers are 4 bytes (8 for ll/j), floating point 8 bytes (L is narrowed),
+// strings a length byte followed by at most LOGGER_BINARY_STRING_LENGTH characters. tools/decode_binary_log.py mirrors these rules.
+int Logger::encodeBinary(uint8_t *record,const char *format,va_list args)
+{
+    uint32_t address = (uint32_t)(uintptr_t)format;
+    int length = 0;
+    append_bytes(record,length,&address,sizeof(address));
+    for (const char *p = format; *p != '\0'; ++p) {
+        if (*p != '%') {
+            continue;
+        }
+        ++p;
+        if (*p == '%') {
+            continue;
+        }
+
+        // flags, then width and precision (a '*' consumes an int argument)
+        while (*p != '\0' && strchr("-+ #0",*p) != NULL) ++p;
+        for (int field = 0; field < 2; ++field) {
+            if (*p == '*') {
+                int32_t star = (int32_t)va_arg(args,int);
+                if (append_bytes(record,length,&star,sizeof(star)) == false) return -1;
+                ++p;
+            }
+            while (*p >= '0' && *p <= '9') ++p;
+            if (field == 0 && *p == '.') ++p;
+            else break;
+        }
+
+        // length modifiers
+        int longs = 0;
+        bool wide = false;
+        bool long_double = false;
+        while (*p != '\0' && strchr("hljztL",*p) != NULL) {
+            if (*p == 'l') ++longs;
+            if (*p == 'j') wide = true;
+            if (*p == 'L') long_double = true;
+            ++p;
+        }
+        wide = wide || (longs >= 2);
+
+        // conversion
+        bool ok = true;
+        switch (*p) {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                if (wide == true) {
+                    int64_t value = (int64_t)va_arg(args,long long);
+                    ok = append_bytes(record,length,&value,sizeof(value));
+                }
+                else {
+                    int32_t value = (longs == 1 || strchr("zt",*(p-1)) != NULL) ? (int32_t)va_arg(args,long) : (int32_t)va_arg(args,int);
+                    ok = append_bytes(record,length,&value,sizeof(value));
+                }
+                break;
+            case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A': {
+                // a long double is passed as such... read it whole, record it as a double
+                double value = (long_double == true) ? (double)va_arg(args,long double) : va_arg(args,double);
+                ok = append_bytes(record,length,&value,sizeof(value));
+                break;
+            }
+            case 's': {
+                const char *str = va_arg(args,const char *);
+                if (str == NULL) str = "(null)";
+                int str_length = 0;
+                while (str_length < LOGGER_BINARY_STRING_LENGTH && str[str_length] != '\0') ++str_length;
+                if (str_length > LOGGER_BINARY_RECORD_LENGTH - length - 1) str_length = LOGGER_BINARY_RECORD_LENGTH - length - 1;
+                uint8_t str_length_byte = (uint8_t)str_length;
+                ok = (str_length >= 0) && append_bytes(record,length,&str_length_byte,1) && append_bytes(record,length,str,str_length);
+                break;
+            }
+            case 'p': {
+                uint32_t value = (uint32_t)(uintptr_t)va_arg(args,void *);
+                ok = append_bytes(record,length,&value,sizeof(value));
+                break;
+            }
+            case 'n':
+                (void)va_arg(args,void *);
+                break;
+            default:
+                // unknown/truncated conversion... record what we have
+                return length;
+        }
+        if (ok == false) {
+            return -1;
+        }
+    }
+    return length;
+}
+
+// write a binary log frame to the serial port
+void Logger::writeBinaryFrame(const uint8_t *record,int length)
+{
+    this->m_pc->putc(LOGGER_FRAME_SYNC_0);
+    this->m_pc->putc(LOGGER_FRAME_SYNC_1);
+    this->m_pc->putc(length & 0xFF);
+    this->m_pc->putc((length >> 8) & 0xFF);
+    for (int i = 0; i < length; ++i) {
+        this->m_pc->putc(record[i]);
+    }
+}
+
+// write out committed records from the async ring
+void Logger::drain()
+{
+    AsyncState *async = this->m_async;
+    uint32_t mask = async->ring_length - 1;
+    while (async->tail != async->head) {
+        uint32_t offset = async->tail & mask;
+        uint32_t header = *((volatile uint32_t *)&async->ring[offset]);
+        uint32_t consumed = 0;
+        if ((header & LOGGER_RECORD_COMMITTED) == 0) {
+            // producer still copying... it will signal us once committed
+            break;
+        }
+        if ((header & LOGGER_RECORD_SKIP) != 0) {
+            consumed = header & LOGGER_RECORD_LENGTH_MASK;
+        }
+        else if ((header & LOGGER_RECORD_BINARY) != 0) {
+            int length = (int)(header & LOGGER_RECORD_LENGTH_MASK);
+            this->writeBinaryFrame(&async->ring[offset + 4],length);
+            consumed = LOGGER_RECORD_SIZE(length);
+        }
+        else {
+            int length = (int)(header & LOGGER_RECORD_LENGTH_MASK);
+            this->m_pc->printf("%.*s",length,(const char *)&async->ring[offset + 4]);
+            consumed = LOGGER_RECORD_SIZE(length);
+        }
+
+        // free space is kept zeroed so that stale bytes are never mistaken for a committed header
+        memset(&async->ring[offset],0,consumed);
+        __DMB();
+        async->tail += consumed;
+    }
+    if (async->dropped != async->dropped_reported) {
+        async->dropped_reported = async->dropped;
+        if (async->binary == true) {
+            uint8_t record[8];
+            uint32_t address = (uint32_t)(uintptr_t)s_dropped_format;
+            uint32_t dropped = async->dropped_reported;
+            memcpy(&record[0],&address,4);
+            memcpy(&record[4],&dropped,4);
+            this->writeBinaryFrame(record,sizeof(record));
+        }
+        else {
+            this->m_pc->printf(s_dropped_format,(unsigned long)async->dropped_reported);
+        }
+    }
+}
+
+// async drain thread
+void Logger::drain_task()
+{
+    while(true) {
+        this->m_async->pending->wait();
+        this->drain();
+    }
 }
 
 // Log the ouput to the attached serial console
 void Logger::logIt(const char *format,...)
 {
 #if !defined(QUIET_LOGGING)
-    // build the variable args into a string
     va_list args;
+
+    // binary: record the format address and raw arguments only (formatting happens on the host)
+    if (this->m_async != NULL && this->m_async->binary == true) {
+        uint8_t record[LOGGER_BINARY_RECORD_LENGTH];
+        va_start(args, format);
+        int record_length = this->encodeBinary(record,format,args);
+        va_end(args);
+        if (record_length < 0) {
+            core_util_atomic_incr_u32(&this->m_async->dropped,1);
+        }
+        else if (this->enqueue((const char *)record,record_length,LOGGER_RECORD_BINARY) == true) {
+            this->m_async->pending->release();
+        }
+        return;
+    }
+
+    // build the variable args into a string (vsnprintf always terminates the buffer)
     char buffer[LOGGER_BUFFER_LENGTH+1];
-    memset(buffer,0,LOGGER_BUFFER_LENGTH+1);
     va_start(args, format);
-    vsnprintf(buffer,LOGGER_BUFFER_LENGTH,format,args);
+    int length = vsnprintf(buffer,LOGGER_BUFFER_LENGTH,format,args);
 
     // clean up...
     va_end(args);
 
+    // async: hand off to the drain thread (never blocks on the serial port)
+    if (this->m_async != NULL) {
+        if (length > LOGGER_BUFFER_LENGTH-1) length = LOGGER_BUFFER_LENGTH-1;
+        if (length > 0 && this->enqueue(buffer,length) == true) {
+            this->m_async->pending->release();
+        }
+        return;
+    }
+
     // print it...
     if (this->m_pc != NULL)
         this->m_pc->printf("%s",buffer);
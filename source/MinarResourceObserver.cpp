@@ -30,7 +30,7 @@
      this->setObserving(false);
         
      // DEBUG
-     this->logger()->log("MinarResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
+     LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"MinarResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
  }
 
  // destructor
@@ -40,12 +40,7 @@
 
  // observation task method
  void MinarResourceObserver::observation_task() {
-     if (this->isObserving() == true && this->getResource() != NULL) {
-         DynamicResource *res = this->getResource();
-         if (res != NULL && res->isRegistered() == true) {
-             res->observe();
-         }
-     }
+     this->observeResource(0);
  }
 
  // begin observing...
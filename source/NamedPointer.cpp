@@ -24,36 +24,70 @@
 #include "mbed-connector-interface/ObjectInstanceManager.h"
 
 // constructor
-NamedPointer::NamedPointer(string name,void *ptr,int index) {
-    this->m_name = name;
+NamedPointer::NamedPointer(IdentifierHandle id,void *ptr,int index) {
+    this->m_id = id;
     this->m_ptr = ptr;
     this->m_index = index;
-    this->m_list = (void *)new NamedPointerList();
+    this->m_list = NULL;
 }
 
 // copy constructor
 NamedPointer::NamedPointer(const NamedPointer &np) {
-    this->m_name = np.m_name;
+    this->m_id = np.m_id;
     this->m_ptr = np.m_ptr;
     this->m_index = np.m_index;
     this->m_list = this->copyList(np.m_list);
 }
 
+// assignment
+NamedPointer &NamedPointer::operator=(const NamedPointer &np) {
+    if (this != &np) {
+        void *list = this->copyList(np.m_list);
+        this->freeList();
+        this->m_id = np.m_id;
+        this->m_ptr = np.m_ptr;
+        this->m_index = np.m_index;
+        this->m_list = list;
+    }
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+// move constructor
+NamedPointer::NamedPointer(NamedPointer &&np) noexcept {
+    this->m_id = np.m_id;
+    this->m_ptr = np.m_ptr;
+    this->m_index = np.m_index;
+    this->m_list = np.m_list;
+    np.m_list = NULL;
+}
+
+// move assignment
+NamedPointer &NamedPointer::operator=(NamedPointer &&np) noexcept {
+    if (this != &np) {
+        this->freeList();
+        this->m_id = np.m_id;
+        this->m_ptr = np.m_ptr;
+        this->m_index = np.m_index;
+        this->m_list = np.m_list;
+        np.m_list = NULL;
+    }
+    return *this;
+}
+#endif
+
 // Destructor
 NamedPointer::~NamedPointer() {
-    NamedPointerList *list = (NamedPointerList *)this->m_list;
-    if (list != NULL) {
-        delete list;
-    }
+    this->freeList();
 }
 
 // Get the Name
-string NamedPointer::name() { 
-    return this->m_name; 
+const string &NamedPointer::name() { 
+    return IdentifierTable::instance()->name(this->m_id); 
 }
 
 // Get the Pointer
-void *NamedPointer::ptr() { 
+void *NamedPointer::ptr() const { 
     return this->m_ptr; 
 }
 
@@ -64,16 +98,33 @@ int NamedPointer::index() {
 
 // Get any associated list
 void *NamedPointer::list() { 
+    if (this->m_list == NULL) {
+        this->m_list = (void *)new NamedPointerList();
+    }
     return this->m_list; 
 }
 
+// Get the size of any associated list
+int NamedPointer::listSize() {
+    NamedPointerList *list = (NamedPointerList *)this->m_list;
+    return (list != NULL) ? (int)list->size() : 0;
+}
+
 // Copy the list
 void *NamedPointer::copyList(void *list) {
-    NamedPointerList *npl = new NamedPointerList();
     NamedPointerList *tmp_list = (NamedPointerList *)list;
-    for(int i=0;tmp_list != NULL && i<(int)tmp_list->size();++i) {
-        npl->push_back(tmp_list->at(i));
+    if (tmp_list == NULL) {
+        return NULL;
+    }
+    return (void *)new NamedPointerList(*tmp_list);
+}
+
+// Free the list
+void NamedPointer::freeList() {
+    NamedPointerList *list = (NamedPointerList *)this->m_list;
+    if (list != NULL) {
+        delete list;
     }
-    return (void *)npl;
+    this->m_list = NULL;
 }
  
\ No newline at end of file
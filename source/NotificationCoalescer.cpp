@@ -0,0 +1,180 @@
+/**
+ * @file    NotificationCoalescer.cpp
+ * @brief   mbed CoAP Endpoint notification coalescing window
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/NotificationCoalescer.h"
+
+ // main loop work support
+ #include "mbed-connector-interface/mbedEndpointNetworkImpl.h"
+
+ // constructor
+ NotificationCoalescer::NotificationCoalescer(const Logger *logger,uint32_t window_ms,int depth) : m_mutex(), m_timeout() {
+     this->m_logger = (Logger *)logger;
+     this->m_window_ms = window_ms;
+     this->m_depth = (depth > 0) ? depth : NOTIFICATION_COALESCE_DEPTH;
+     this->m_count = 0;
+     this->m_armed = false;
+     this->m_pending = (Pending *)calloc(this->m_depth,sizeof(Pending));
+     if (this->m_pending == NULL) {
+         this->m_depth = 0;
+     }
+     this->resetStatistics();
+ }
+
+ // destructor
+ NotificationCoalescer::~NotificationCoalescer() {
+     this->m_timeout.detach();
+     for (int i = 0; i < this->m_depth; ++i) {
+         if (this->m_pending[i].data != NULL) free(this->m_pending[i].data);
+     }
+     if (this->m_pending != NULL) free(this->m_pending);
+ }
+
+ // hold a notification until the window closes
+ bool NotificationCoalescer::submit(DynamicResource *resource,const uint8_t *data,int data_length) {
+     if (resource == NULL || data_length < 0 || (data_length > 0 && data == NULL)) {
+         return false;
+     }
+     if (core_util_is_isr_active() == true) {
+         // no locking or allocation in ISR context... the caller sends it now
+         return false;
+     }
+     this->m_mutex.lock();
+
+     // latest value wins within a window
+     Pending *pending = NULL;
+     for (int i = 0; i < this->m_count && pending == NULL; ++i) {
+         if (this->m_pending[i].resource == resource) {
+             pending = &this->m_pending[i];
+             ++this->m_stats.superseded;
+         }
+     }
+     if (pending == NULL) {
+         if (this->m_count >= this->m_depth) {
+             // window full... send this one now
+             ++this->m_stats.overflowed;
+             this->m_mutex.unlock();
+             return false;
+         }
+         pending = &this->m_pending[this->m_count];
+         pending->resource = resource;
+         pending->held_us = us_ticker_read();
+         ++this->m_count;
+     }
+
+     // copy the payload (buffers grow but are kept for later windows)
+     if (data_length > pending->size) {
+         uint8_t *buffer = (uint8_t *)realloc(pending->data,data_length);
+         if (buffer == NULL) {
+             // unable to hold it... release the slot (keeping its buffer) and send it now
+             Pending last = this->m_pending[this->m_count - 1];
+             this->m_pending[this->m_count - 1] = *pending;
+             *pending = last;
+             this->m_pending[this->m_count - 1].resource = NULL;
+             --this->m_count;
+             ++this->m_stats.overflowed;
+             this->m_mutex.unlock();
+             return false;
+         }
+         pending->data = buffer;
+         pending->size = data_length;
+     }
+     if (data_length > 0) {
+         memcpy(pending->data,data,data_length);
+     }
+     pending->length = data_length;
+     ++this->m_stats.submitted;
+
+     // the first notification opens the window
+     if (this->m_armed == false) {
+         this->m_armed = true;
+         this->m_timeout.attach_us(callback(this,&NotificationCoalescer::expired),this->m_window_ms * 1000);
+     }
+     this->m_mutex.unlock();
+     return true;
+ }
+
+ // write all held notifications
+ void NotificationCoalescer::flush() {
+     this->m_mutex.lock();
+     this->m_timeout.detach();
+     this->m_armed = false;
+     if (this->m_count > 0) {
+         uint32_t now = us_ticker_read();
+         for (int i = 0; i < this->m_count; ++i) {
+             uint32_t latency_us = now - this->m_pending[i].held_us;
+             this->m_stats.total_latency_us += latency_us;
+             if (latency_us > this->m_stats.max_latency_us) this->m_stats.max_latency_us = latency_us;
+             this->m_pending[i].resource->replayNotification(this->m_pending[i].data,this->m_pending[i].length);
+             this->m_pending[i].resource = NULL;
+         }
+         ++this->m_stats.batches;
+         this->m_stats.flushed += this->m_count;
+         if ((uint32_t)this->m_count > this->m_stats.max_batch) this->m_stats.max_batch = this->m_count;
+         LOG_TRACE(this->logger(),LOGGER_MODULE_RESOURCE,"NotificationCoalescer: flushed %d notifications",this->m_count);
+         this->m_count = 0;
+     }
+     this->m_mutex.unlock();
+ }
+
+ // window closed (timer interrupt context... hand the flush to the main loop)
+ void NotificationCoalescer::expired() {
+     if (net_post_work(&NotificationCoalescer::flush_work,(void *)this) == false) {
+         // main loop work queue full... try again after another window
+         this->m_timeout.attach_us(callback(this,&NotificationCoalescer::expired),this->m_window_ms * 1000);
+     }
+ }
+
+ // main loop work: flush the window
+ void NotificationCoalescer::flush_work(void *coalescer) {
+     ((NotificationCoalescer *)coalescer)->flush();
+ }
+
+ // get a snapshot of the statistics
+ NotificationCoalescer::Statistics NotificationCoalescer::getStatistics() {
+     this->m_mutex.lock();
+     Statistics stats = this->m_stats;
+     this->m_mutex.unlock();
+     return stats;
+ }
+
+ // reset all statistics
+ void NotificationCoalescer::resetStatistics() {
+     this->m_mutex.lock();
+     memset(&this->m_stats,0,sizeof(this->m_stats));
+     this->m_mutex.unlock();
+ }
+
+ // log a summary of the statistics
+ void NotificationCoalescer::logStatistics() {
+     Statistics stats = this->getStatistics();
+     uint32_t avg_batch_x10 = (stats.batches > 0) ? (uint32_t)((10 * (uint64_t)stats.flushed) / stats.batches) : 0;
+     uint32_t avg_latency_us = (stats.flushed > 0) ? (uint32_t)(stats.total_latency_us / stats.flushed) : 0;
+     this->logger()->log("NotificationCoalescer: window: %u ms submitted: %u superseded: %u overflowed: %u batches: %u batch(avg/max): %u.%u/%u latency(avg/max): %u/%u us",
+                         (unsigned)this->m_window_ms,(unsigned)stats.submitted,(unsigned)stats.superseded,(unsigned)stats.overflowed,(unsigned)stats.batches,
+                         (unsigned)(avg_batch_x10 / 10),(unsigned)(avg_batch_x10 % 10),(unsigned)stats.max_batch,(unsigned)avg_latency_us,(unsigned)stats.max_latency_us);
+ }
+
+ // our logger
+ Logger *NotificationCoalescer::logger() {
+     return this->m_logger;
+ }
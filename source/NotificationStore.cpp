@@ -0,0 +1,199 @@
+/**
+ * @file    NotificationStore.cpp
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/NotificationStore.h"
+
+ // time() support
+ #include <time.h>
+
+ // RTC values before this are treated as unset (2018-01-01)
+ #define NOTIFICATION_STORE_MIN_EPOCH        1514764800
+
+ // constructor
+ NotificationStore::NotificationStore(uint32_t capacity) : m_mutex() {
+     this->m_capacity = capacity;
+     this->m_head = 0;
+     this->m_tail = 0;
+     this->m_used = 0;
+     this->m_count = 0;
+     this->m_dropped = 0;
+ }
+
+ // destructor
+ NotificationStore::~NotificationStore() {
+ }
+
+ // open the store
+ bool NotificationStore::open() {
+     return this->m_capacity > NOTIFICATION_RECORD_HEADER_LENGTH;
+ }
+
+ // append a notification
+ bool NotificationStore::push(const char *name,uint64_t timestamp_ms,const uint8_t *data,int data_length) {
+     uint8_t header[NOTIFICATION_RECORD_HEADER_LENGTH];
+     int name_length = (name != NULL) ? (int)strlen(name) : 0;
+     if (name_length > 255 || data_length < 0 || (data_length > 0 && data == NULL)) {
+         return false;
+     }
+     if (core_util_is_isr_active() == true) {
+         // the backends lock (and may do file I/O)... not from ISR context
+         return false;
+     }
+     uint32_t length = NOTIFICATION_RECORD_HEADER_LENGTH + name_length + data_length;
+     if (length > 0xFFFF || length > this->m_capacity) {
+         return false;
+     }
+
+     header[0] = (uint8_t)(length & 0xFF);
+     header[1] = (uint8_t)((length >> 8) & 0xFF);
+     header[2] = (uint8_t)name_length;
+     header[3] = 0;
+     for (int i = 0; i < 8; ++i) {
+         header[4 + i] = (uint8_t)((timestamp_ms >> (8 * i)) & 0xFF);
+     }
+
+     this->m_mutex.lock();
+     bool ok = true;
+     while (ok == true && (this->m_capacity - this->m_used) < length) {
+         // full... drop the oldest
+         ok = this->dropOldest();
+     }
+     if (ok == true) {
+         uint32_t offset = this->m_head;
+         ok = this->ringWrite(offset,header,NOTIFICATION_RECORD_HEADER_LENGTH);
+         offset = (offset + NOTIFICATION_RECORD_HEADER_LENGTH) % this->m_capacity;
+         if (ok == true && name_length > 0) {
+             ok = this->ringWrite(offset,(const uint8_t *)name,name_length);
+             offset = (offset + name_length) % this->m_capacity;
+         }
+         if (ok == true && data_length > 0) {
+             ok = this->ringWrite(offset,data,data_length);
+         }
+         if (ok == true) {
+             this->m_head = (this->m_head + length) % this->m_capacity;
+             this->m_used += length;
+             ++this->m_count;
+             ok = this->saveState();
+         }
+     }
+     this->m_mutex.unlock();
+     return ok;
+ }
+
+ // remove the oldest notification
+ int NotificationStore::shift(char *name,int name_length,uint64_t &timestamp_ms,uint8_t *data,int data_length) {
+     uint8_t header[NOTIFICATION_RECORD_HEADER_LENGTH];
+     int result = -1;
+     this->m_mutex.lock();
+     if (this->m_count > 0 && this->ringRead(this->m_tail,header,NOTIFICATION_RECORD_HEADER_LENGTH) == true) {
+         uint32_t length = (uint32_t)header[0] | ((uint32_t)header[1] << 8);
+         int stored_name_length = header[2];
+         int payload_length = (int)length - NOTIFICATION_RECORD_HEADER_LENGTH - stored_name_length;
+         uint32_t offset = (this->m_tail + NOTIFICATION_RECORD_HEADER_LENGTH) % this->m_capacity;
+         timestamp_ms = 0;
+         for (int i = 0; i < 8; ++i) {
+             timestamp_ms |= ((uint64_t)header[4 + i]) << (8 * i);
+         }
+         if (name != NULL && name_length > 0) {
+             int copy = (stored_name_length < name_length) ? stored_name_length : (name_length - 1);
+             this->ringRead(offset,(uint8_t *)name,copy);
+             name[copy] = '\0';
+         }
+         offset = (offset + stored_name_length) % this->m_capacity;
+         if (data != NULL && data_length > 0 && payload_length > 0) {
+             this->ringRead(offset,data,(payload_length < data_length) ? payload_length : data_length);
+         }
+         result = (payload_length < data_length) ? payload_length : data_length;
+         this->m_tail = (this->m_tail + length) % this->m_capacity;
+         this->m_used -= length;
+         --this->m_count;
+         this->saveState();
+     }
+     this->m_mutex.unlock();
+     return result;
+ }
+
+ // discard all notifications
+ void NotificationStore::clear() {
+     this->m_mutex.lock();
+     this->m_head = 0;
+     this->m_tail = 0;
+     this->m_used = 0;
+     this->m_count = 0;
+     this->saveState();
+     this->m_mutex.unlock();
+ }
+
+ // number of stored notifications
+ int NotificationStore::count() {
+     this->m_mutex.lock();
+     int count = (int)this->m_count;
+     this->m_mutex.unlock();
+     return count;
+ }
+
+ // number of dropped notifications
+ uint32_t NotificationStore::dropped() {
+     return this->m_dropped;
+ }
+
+ // current time for timestamps
+ uint64_t NotificationStore::now() {
+     time_t seconds = time(NULL);
+     if (seconds >= (time_t)NOTIFICATION_STORE_MIN_EPOCH) {
+         return ((uint64_t)seconds) * 1000;
+     }
+     return Kernel::get_ms_count();
+ }
+
+ // drop the oldest record (mutex held)
+ bool NotificationStore::dropOldest() {
+     uint8_t header[2];
+     if (this->m_count == 0 || this->ringRead(this->m_tail,header,2) == false) {
+         return false;
+     }
+     uint32_t length = (uint32_t)header[0] | ((uint32_t)header[1] << 8);
+     this->m_tail = (this->m_tail + length) % this->m_capacity;
+     this->m_used -= length;
+     --this->m_count;
+     ++this->m_dropped;
+     return true;
+ }
+
+ // read from the ring (wraps at capacity)
+ bool NotificationStore::ringRead(uint32_t offset,uint8_t *buffer,uint32_t length) {
+     uint32_t first = this->m_capacity - offset;
+     if (length <= first) {
+         return this->readAt(offset,buffer,length);
+     }
+     return this->readAt(offset,buffer,first) && this->readAt(0,buffer + first,length - first);
+ }
+
+ // write to the ring (wraps at capacity)
+ bool NotificationStore::ringWrite(uint32_t offset,const uint8_t *buffer,uint32_t length) {
+     uint32_t first = this->m_capacity - offset;
+     if (length <= first) {
+         return this->writeAt(offset,buffer,length);
+     }
+     return this->writeAt(offset,buffer,first) && this->writeAt(0,buffer + first,length - first);
+ }
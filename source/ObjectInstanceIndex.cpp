@@ -0,0 +1,160 @@
+/**
+ * @file    ObjectInstanceIndex.cpp
+ * @brief   mbed CoAP Endpoint Object/Resource identifier index for the ObjectInstanceManager
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ObjectInstanceIndex.h"
+
+ // malloc/memcpy support
+ #include <stdlib.h>
+ #include <string.h>
+
+ // constructor
+ ObjectInstanceIndex::ObjectInstanceIndex() {
+     this->m_entries = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+ }
+
+ // copy constructor
+ ObjectInstanceIndex::ObjectInstanceIndex(const ObjectInstanceIndex &index) {
+     this->m_entries = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+     if (index.m_capacity > 0) {
+         this->m_entries = (Entry *)malloc(index.m_capacity*sizeof(Entry));
+         if (this->m_entries != NULL) {
+             memcpy(this->m_entries,index.m_entries,index.m_capacity*sizeof(Entry));
+             this->m_capacity = index.m_capacity;
+             this->m_size = index.m_size;
+         }
+     }
+ }
+
+ // assignment (copy and swap: the argument is our deep copy, our old entries are freed with it)
+ ObjectInstanceIndex &ObjectInstanceIndex::operator=(ObjectInstanceIndex index) {
+     this->swap(index);
+     return *this;
+ }
+
+ // exchange entries with another index
+ void ObjectInstanceIndex::swap(ObjectInstanceIndex &index) {
+     Entry *entries = this->m_entries;
+     int capacity = this->m_capacity;
+     int size = this->m_size;
+     this->m_entries = index.m_entries;
+     this->m_capacity = index.m_capacity;
+     this->m_size = index.m_size;
+     index.m_entries = entries;
+     index.m_capacity = capacity;
+     index.m_size = size;
+ }
+
+ // destructor
+ ObjectInstanceIndex::~ObjectInstanceIndex() {
+     this->clear();
+ }
+
+ // clear the index
+ void ObjectInstanceIndex::clear() {
+     if (this->m_entries != NULL) free(this->m_entries);
+     this->m_entries = NULL;
+     this->m_capacity = 0;
+     this->m_size = 0;
+ }
+
+ // lookup the value for a given identifier pair
+ int ObjectInstanceIndex::lookup(IdentifierHandle obj_id,IdentifierHandle res_id) {
+     Entry *entry = this->find(obj_id,res_id);
+     if (entry != NULL && entry->obj_id != IDENTIFIER_INVALID) {
+         return entry->value;
+     }
+     return -1;
+ }
+
+ // store the value for a given identifier pair
+ bool ObjectInstanceIndex::set(IdentifierHandle obj_id,IdentifierHandle res_id,int value) {
+     if (obj_id == IDENTIFIER_INVALID) {
+         return false;
+     }
+
+     // keep the load factor at or below 50% so that probe sequences stay short
+     if ((2 * (this->m_size + 1)) > this->m_capacity && this->grow() == false) {
+         return false;
+     }
+     Entry *entry = this->find(obj_id,res_id);
+     if (entry->obj_id == IDENTIFIER_INVALID) {
+         entry->obj_id = obj_id;
+         entry->res_id = res_id;
+         ++this->m_size;
+     }
+     entry->value = value;
+     return true;
+ }
+
+ // find the slot holding (or that would hold) a given pair (open addressing, linear probing)
+ ObjectInstanceIndex::Entry *ObjectInstanceIndex::find(IdentifierHandle obj_id,IdentifierHandle res_id) {
+     if (this->m_capacity == 0) {
+         return NULL;
+     }
+     int mask = this->m_capacity - 1;
+     int i = this->slot(obj_id,res_id);
+     while (this->m_entries[i].obj_id != IDENTIFIER_INVALID) {
+         if (this->m_entries[i].obj_id == obj_id && this->m_entries[i].res_id == res_id) {
+             break;
+         }
+         i = (i + 1) & mask;
+     }
+     return &(this->m_entries[i]);
+ }
+
+ // double the capacity and rehash
+ bool ObjectInstanceIndex::grow() {
+     Entry *old_entries = this->m_entries;
+     int old_capacity = this->m_capacity;
+     int capacity = (old_capacity > 0) ? (old_capacity << 1) : 16;
+     Entry *entries = (Entry *)malloc(capacity*sizeof(Entry));
+     if (entries == NULL) {
+         return false;
+     }
+
+     // IDENTIFIER_INVALID is all 1's... so 0xFF fill marks every slot empty
+     memset(entries,0xFF,capacity*sizeof(Entry));
+     this->m_entries = entries;
+     this->m_capacity = capacity;
+     this->m_size = 0;
+     for (int i = 0; i < old_capacity; ++i) {
+         if (old_entries[i].obj_id != IDENTIFIER_INVALID) {
+             Entry *entry = this->find(old_entries[i].obj_id,old_entries[i].res_id);
+             *entry = old_entries[i];
+             ++this->m_size;
+         }
+     }
+     if (old_entries != NULL) free(old_entries);
+     return true;
+ }
+
+ // home slot for a given pair (Fibonacci hash of the combined identifiers)
+ int ObjectInstanceIndex::slot(IdentifierHandle obj_id,IdentifierHandle res_id) {
+     uint32_t h = (obj_id * 2654435761U) ^ (res_id * 2246822519U);
+     h ^= (h >> 16);
+     return (int)(h & (uint32_t)(this->m_capacity - 1));
+ }
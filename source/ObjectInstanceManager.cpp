@@ -40,6 +40,7 @@
      this->m_logger = (Logger *)logger;
      this->m_ep = (void *)ep;
      this->m_object_list.clear();
+     this->m_object_list.reserve(OIM_OBJECT_POOL_SIZE);
      this->m_instance_number = 0;
 }
 
@@ -49,37 +50,53 @@ ObjectInstanceManager::ObjectInstanceManager(const ObjectInstanceManager &oim) {
     this->m_ep = oim.m_ep;
     this->m_object_list = oim.m_object_list;
     this->m_instance_number = oim.m_instance_number;
+    this->m_index = oim.m_index;
 }
 
 // destructor
 ObjectInstanceManager::~ObjectInstanceManager() {
     this->m_object_list.clear();
+    this->m_index.clear();
 }
 
 // create a Dynamic Resource Instance
 void *ObjectInstanceManager::createDynamicResourceInstance(char *objID,char *resID,char *resName,int resType,bool observable) {
+    IdentifierTable *ids = IdentifierTable::instance();
+    return this->createDynamicResourceInstance(ids->intern(objID),ids->intern(resID),resName,resType,observable);
+}
+
+// create a Dynamic Resource Instance (identifier handles)
+void *ObjectInstanceManager::createDynamicResourceInstance(IdentifierHandle objID,IdentifierHandle resID,const char *resName,int resType,bool observable) {
     void *res = NULL;
+    char res_buf[IDENTIFIER_MAX_DIGITS+2];
     M2MObjectInstance *instance = (M2MObjectInstance *)this->getOrCreateInstance(objID,resID);
     if (instance != NULL) {
         // DEBUG
         //this->logger()->log("ObjectInstanceManager: Creating Dynamic Resource: ObjID:%s ResID:%s ResName:%s Type:%d Observable: %d",objID,resID,resName,resType,observable);
     
         // create the resource
-        res = (void *)instance->create_dynamic_resource(resID,resName,(M2MResourceInstance::ResourceType)resType,observable);
+        res = (void *)instance->create_dynamic_resource(IdentifierTable::instance()->toString(resID,res_buf,sizeof(res_buf)),resName,(M2MResourceInstance::ResourceType)resType,observable);
     }
     return res;   
 }
 
 // create a Static Resource Instance
 void *ObjectInstanceManager::createStaticResourceInstance(char *objID,char *resID,char *resName,int resType,void *data,int data_length) {
+    IdentifierTable *ids = IdentifierTable::instance();
+    return this->createStaticResourceInstance(ids->intern(objID),ids->intern(resID),resName,resType,data,data_length);
+}
+
+// create a Static Resource Instance (identifier handles)
+void *ObjectInstanceManager::createStaticResourceInstance(IdentifierHandle objID,IdentifierHandle resID,const char *resName,int resType,void *data,int data_length) {
     void *res = NULL;
+    char res_buf[IDENTIFIER_MAX_DIGITS+2];
     M2MObjectInstance *instance = (M2MObjectInstance *)this->getOrCreateInstance(objID,resID);
     if (instance != NULL) {
         // DEBUG
         //this->logger()->log("ObjectInstanceManager: Creating Static Resource: ObjID:%s ResID:%s ResName:%s Type:%d DataLength: %d",objID,resID,resName,resType,data_length);
     
         // create the resource
-        res = (void *)instance->create_static_resource(resID,resName,(M2MResourceInstance::ResourceType)resType,(uint8_t *)data,(uint8_t)data_length);
+        res = (void *)instance->create_static_resource(IdentifierTable::instance()->toString(resID,res_buf,sizeof(res_buf)),resName,(M2MResourceInstance::ResourceType)resType,(uint8_t *)data,(uint8_t)data_length);
     }
     return res;  
 }
@@ -90,76 +107,67 @@ int ObjectInstanceManager::getLastCreatedInstanceNumber() {
 }
 
 // create and/or retrieve a given instance
-void *ObjectInstanceManager::getOrCreateInstance(char *objID,char *resID) {
+// (lists are only ever addressed by position, so growing them never leaves a stale pointer behind)
+void *ObjectInstanceManager::getOrCreateInstance(IdentifierHandle objID,IdentifierHandle resID) {
     void *instance = NULL;
-    NamedPointer *obj_np = this->getOrCreateObject(objID);
-    if (obj_np != NULL) {
+    int obj_index = this->getOrCreateObject(objID);
+    if (obj_index >= 0) {
+        NamedPointer *obj_np = &(this->m_object_list[obj_index]);
         NamedPointerList *list = (NamedPointerList *)obj_np->list();
-        NamedPointer *inst_np = this->getNamedPointer(resID,list);
-        if (inst_np != NULL) {
-            // instance already exists... so create another one (n)...
-            M2MObject *obj = (M2MObject *)(obj_np->ptr());
-            if (obj != NULL) {
-                instance = (void *)obj->create_object_instance();
-                this->m_instance_number = inst_np->index()+1;
-                NamedPointer new_inst_np(string(resID),instance,this->m_instance_number);
-                list->push_back(new_inst_np); 
-            }
-        }
-        else if (list->size() > 0) {
-            // 0th instance exists... parent the resource to it...
-            this->m_instance_number = 0;
-            instance = (void *)(list->at(0).ptr());
+        int latest = this->m_index.lookup(objID,resID);
+        int number = (latest >= 0) ? latest + 1 : 0;
+        
+        // instance numbers are the position in the object's instance list
+        if (number < (int)list->size()) {
+            // instance (n) already exists (created for another resource)... parent the resource to it...
+            instance = (void *)(list->at(number).ptr());
         }
-        else {            
-            // no instance does not exist so create one (0)..
+        else {
+            // instance (n) does not exist so create it...
             M2MObject *obj = (M2MObject *)(obj_np->ptr());
             if (obj != NULL) {
                 instance = (void *)obj->create_object_instance();
-                this->m_instance_number = 0;
-                NamedPointer new_inst_np(string(resID),instance,this->m_instance_number);
+                number = (int)list->size();
+                NamedPointer new_inst_np(resID,instance,number);
                 list->push_back(new_inst_np);
             }
         }
+        if (instance != NULL) {
+            this->m_instance_number = number;
+            this->m_index.set(objID,resID,number);
+        }
     }
     else {
         // DEBUG
-        this->logger()->log("getOrCreateInstance: unable to create object instance for objID:%s",objID); 
+        LOG_ERROR(this->logger(),LOGGER_MODULE_OIM,"getOrCreateInstance: unable to create object instance for objID:%s",IdentifierTable::instance()->toString(objID).c_str()); 
     }
     return instance;
 }
 
-// create and/or retrieve a given objectID
-NamedPointer *ObjectInstanceManager::getOrCreateObject(char *objID) {
-    NamedPointer *result = NULL;
-    if (objID != NULL) {
-        result = this->getNamedPointer(objID,&(this->m_object_list));
+// create and/or retrieve a given objectID (returns its position in the object list or -1)
+int ObjectInstanceManager::getOrCreateObject(IdentifierHandle objID) {
+    char obj_buf[IDENTIFIER_MAX_DIGITS+2];
+    if (objID == IDENTIFIER_INVALID) {
+        return -1;
     }
-    if (result == NULL) {            
-        void *obj = (void *)M2MInterfaceFactory::create_object(objID);
-        NamedPointer new_np(string(objID),obj,0);
+    int obj_index = this->m_index.lookup(objID,IDENTIFIER_INVALID);
+    if (obj_index < 0) {            
+        void *obj = (void *)M2MInterfaceFactory::create_object(IdentifierTable::instance()->toString(objID,obj_buf,sizeof(obj_buf)));
+        if (obj == NULL) {
+            return -1;
+        }
+        NamedPointer new_np(objID,obj,0);
         this->m_object_list.push_back(new_np);
-        result = this->getNamedPointer(objID,&(this->m_object_list));
-    }
-    return result;
-}
-
-// get the named pointer for a given id
-NamedPointer *ObjectInstanceManager::getNamedPointer(const char *id,NamedPointerList *list) {
-    NamedPointer *result = NULL;
-    bool found = false;
-    for(int i=0;list != NULL && i<(int)list->size() && !found;++i) {
-        char *tmp_id = (char *)list->at(i).name().c_str();
-        if (id != NULL && tmp_id != NULL && strcmp(id,tmp_id) == 0) {
-            found = true;
-            result = &(list->at(i));
+        obj_index = (int)this->m_object_list.size() - 1;
+        if (this->m_index.set(objID,IDENTIFIER_INVALID,obj_index) == false) {
+            LOG_WARN(this->logger(),LOGGER_MODULE_OIM,"getOrCreateObject: unable to index objID:%s",obj_buf);
         }
     }
-    return result;
+    return obj_index;
 }
 
 // Get our Object List
-NamedPointerList ObjectInstanceManager::getObjectList() {
+const NamedPointerList &ObjectInstanceManager::getObjectList() {
     return this->m_object_list;
 }
 
@@ -0,0 +1,126 @@
+/**
+ * @file    ObservationHistogram.cpp
+ * @brief   mbed CoAP Endpoint observation timing histogram
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ObservationHistogram.h"
+
+ // constructor
+ ObservationHistogram::ObservationHistogram() {
+     this->reset();
+ }
+
+ // discard all samples
+ void ObservationHistogram::reset() {
+     memset(this->m_buckets,0,sizeof(this->m_buckets));
+     this->m_count = 0;
+     this->m_min = 0;
+     this->m_max = 0;
+     this->m_sum = 0;
+ }
+
+ // record a sample
+ void ObservationHistogram::record(uint32_t value) {
+     int bucket = ObservationHistogram::bucketOf(value);
+     if (this->m_buckets[bucket] == 0xFFFF) {
+         // a bucket is about to saturate... halve them all (keeps the shape, ages out old samples)
+         for (int i = 0; i < OBSERVATION_HISTOGRAM_BUCKETS; ++i) {
+             this->m_buckets[i] >>= 1;
+         }
+     }
+     ++this->m_buckets[bucket];
+     if (this->m_count == 0 || value < this->m_min) this->m_min = value;
+     if (value > this->m_max) this->m_max = value;
+     ++this->m_count;
+     this->m_sum += value;
+ }
+
+ // mean of the samples
+ uint32_t ObservationHistogram::mean() {
+     return (this->m_count > 0) ? (uint32_t)(this->m_sum / this->m_count) : 0;
+ }
+
+ // percentile (upper bound of the bucket holding it)
+ uint32_t ObservationHistogram::percentile(int percent) {
+     uint32_t total = 0;
+     for (int i = 0; i < OBSERVATION_HISTOGRAM_BUCKETS; ++i) {
+         total += this->m_buckets[i];
+     }
+     if (total == 0) {
+         return 0;
+     }
+     if (percent < 0) percent = 0;
+     if (percent > 100) percent = 100;
+     uint32_t target = (uint32_t)((((uint64_t)total * percent) + 99) / 100);
+     if (target == 0) target = 1;
+     uint32_t seen = 0;
+     for (int i = 0; i < OBSERVATION_HISTOGRAM_BUCKETS; ++i) {
+         seen += this->m_buckets[i];
+         if (seen >= target) {
+             uint32_t upper = ObservationHistogram::bucketUpperBound(i);
+             return (upper < this->m_max) ? upper : this->m_max;
+         }
+     }
+     return this->m_max;
+ }
+
+ // format a summary
+ int ObservationHistogram::format(char *buffer,int length) {
+     if (buffer == NULL || length <= 0) {
+         return 0;
+     }
+     int n = snprintf(buffer,length,"n:%lu p50:%lu p90:%lu p99:%lu max:%lu",
+                      (unsigned long)this->m_count,(unsigned long)this->percentile(50),(unsigned long)this->percentile(90),
+                      (unsigned long)this->percentile(99),(unsigned long)this->m_max);
+     return (n < length) ? n : (length - 1);
+ }
+
+ // bucket for a given value
+ int ObservationHistogram::bucketOf(uint32_t value) {
+     if (value < (uint32_t)OBSERVATION_HISTOGRAM_SUB_BUCKETS) {
+         // small values are exact
+         return (int)value;
+     }
+     if ((value >> OBSERVATION_HISTOGRAM_RANGE_BITS) != 0) {
+         // out of range
+         return OBSERVATION_HISTOGRAM_BUCKETS - 1;
+     }
+     int msb = 31;
+     while ((value & (1U << msb)) == 0) {
+         --msb;
+     }
+     int shift = msb - OBSERVATION_HISTOGRAM_SUB_BUCKET_BITS;
+     return (OBSERVATION_HISTOGRAM_SUB_BUCKETS * (shift + 1)) + (int)((value >> shift) & (OBSERVATION_HISTOGRAM_SUB_BUCKETS - 1));
+ }
+
+ // largest value held by a given bucket
+ uint32_t ObservationHistogram::bucketUpperBound(int bucket) {
+     if (bucket < OBSERVATION_HISTOGRAM_SUB_BUCKETS) {
+         return (uint32_t)bucket;
+     }
+     if (bucket >= OBSERVATION_HISTOGRAM_BUCKETS - 1) {
+         return 0xFFFFFFFFU;
+     }
+     int shift = (bucket / OBSERVATION_HISTOGRAM_SUB_BUCKETS) - 1;
+     uint32_t sub = (uint32_t)(bucket % OBSERVATION_HISTOGRAM_SUB_BUCKETS);
+     uint32_t lower = (OBSERVATION_HISTOGRAM_SUB_BUCKETS + sub) << shift;
+     return lower + ((1U << shift) - 1);
+ }
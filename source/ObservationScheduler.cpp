@@ -0,0 +1,340 @@
+/**
+ * @file    ObservationScheduler.cpp
+ * @brief   mbed CoAP DynamicResource shared observation scheduler (implementation)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ObservationScheduler.h"
+
+ // ScheduledResourceObserver support
+ #include "mbed-connector-interface/ScheduledResourceObserver.h"
+
+ #ifdef CONNECTOR_USING_SCHEDULER
+
+ // wake the scheduler thread when the head of the heap changes
+ #define SCHEDULER_RESCHEDULE_FLAG      0x01
+
+ // initial heap capacity
+ #define SCHEDULER_INITIAL_CAPACITY     8
+
+ // our instance
+ static ObservationScheduler * volatile _scheduler = NULL;
+
+ // get the shared instance (observers may be started from several threads at once)
+ ObservationScheduler *ObservationScheduler::instance() {
+     ObservationScheduler *scheduler = _scheduler;
+     if (scheduler == NULL) {
+         ObservationScheduler *created = new ObservationScheduler();
+         void *expected = NULL;
+         if (core_util_atomic_cas_ptr((void * volatile *)&_scheduler,&expected,created) == false) {
+             // another thread won the race... use its scheduler (ours stops its thread as it is deleted)
+             delete created;
+         }
+         scheduler = _scheduler;
+     }
+     return scheduler;
+ }
+
+ // constructor
+ ObservationScheduler::ObservationScheduler() : m_mutex(), m_flags(), m_thread(osPriorityNormal,OBSERVATION_SCHEDULER_STACK_SIZE), m_in_flight_done(0) {
+     this->m_heap = NULL;
+     this->m_size = 0;
+     this->m_capacity = 0;
+     this->m_groups = NULL;
+     this->m_num_groups = 0;
+     this->m_groups_capacity = 0;
+     this->m_tick_deadline = 0;
+     this->m_tick_count = 0;
+     this->m_in_flight = NULL;
+     this->m_in_flight_removed = false;
+     this->m_in_flight_waiters = 0;
+     this->m_stop = false;
+     memset(&this->m_stats,0,sizeof(this->m_stats));
+     this->m_thread.start(callback(this,&ObservationScheduler::scheduler_task));
+ }
+
+ // destructor
+ ObservationScheduler::~ObservationScheduler() {
+     // let the observation in progress (if any) complete, then stop the scheduler thread
+     this->m_stop = true;
+     this->m_flags.set(SCHEDULER_RESCHEDULE_FLAG);
+     this->m_thread.join();
+     if (this->m_heap != NULL) free(this->m_heap);
+     if (this->m_groups != NULL) free(this->m_groups);
+ }
+
+ // schedule an observer
+ bool ObservationScheduler::add(ScheduledResourceObserver *observer) {
+     bool added = false;
+     if (observer != NULL && observer->getSleepTime() > 0) {
+         this->m_mutex.lock();
+         if (observer->m_heap_index < 0) {
+             observer->m_deadline = this->firstDeadline(observer->getSleepTime(),Kernel::get_ms_count());
+             added = this->push(observer);
+         }
+         else {
+             // already scheduled
+             added = true;
+         }
+         bool at_head = (observer->m_heap_index == 0);
+         this->m_mutex.unlock();
+
+         // a new earliest deadline... wake the scheduler so that it recomputes its wait
+         if (at_head == true) {
+             this->m_flags.set(SCHEDULER_RESCHEDULE_FLAG);
+         }
+     }
+     return added;
+ }
+
+ // unschedule an observer (if it is being observed, wait for that observation to complete so that it may then be deleted)
+ void ObservationScheduler::remove(ScheduledResourceObserver *observer) {
+     if (observer != NULL) {
+         this->m_mutex.lock();
+         if (observer->m_heap_index >= 0 && observer->m_heap_index < this->m_size && this->m_heap[observer->m_heap_index] == observer) {
+             this->removeAt(observer->m_heap_index);
+         }
+         if (this->m_in_flight == observer) {
+             this->m_in_flight_removed = true;
+
+             // called from within its own observation (scheduler thread)... nothing to wait for
+             while (this->m_in_flight == observer && ThisThread::get_id() != this->m_thread.get_id()) {
+                 ++this->m_in_flight_waiters;
+                 this->m_mutex.unlock();
+                 this->m_in_flight_done.wait();
+                 this->m_mutex.lock();
+             }
+         }
+         this->m_mutex.unlock();
+     }
+ }
+
+ // number of scheduled observers
+ int ObservationScheduler::size() {
+     this->m_mutex.lock();
+     int size = this->m_size;
+     this->m_mutex.unlock();
+     return size;
+ }
+
+ // scheduler thread task
+ void ObservationScheduler::scheduler_task() {
+     while(this->m_stop == false) {
+         ScheduledResourceObserver *due = NULL;
+         uint32_t wait_ms = osWaitForever;
+
+         // pull the earliest observer if its deadline has passed
+         this->m_mutex.lock();
+         if (this->m_size > 0) {
+             uint64_t now = Kernel::get_ms_count();
+             ScheduledResourceObserver *head = this->m_heap[0];
+             if (head->m_deadline <= now) {
+                 due = head;
+                 this->removeAt(0);
+             }
+             else {
+                 wait_ms = (uint32_t)(head->m_deadline - now);
+             }
+         }
+         this->m_mutex.unlock();
+
+         if (due == NULL) {
+             // nothing due... sleep until the next deadline or until the heap head changes
+             this->m_flags.wait_any(SCHEDULER_RESCHEDULE_FLAG,wait_ms);
+             continue;
+         }
+
+         // observations whose deadlines fall within the same window share a tick
+         this->m_mutex.lock();
+         if (this->m_stats.ticks == 0 || due->m_deadline < this->m_tick_deadline || due->m_deadline >= this->m_tick_deadline + OBSERVATION_SCHEDULER_TICK_WINDOW_MS) {
+             this->m_tick_deadline = due->m_deadline;
+             this->m_tick_count = 0;
+             ++this->m_stats.ticks;
+         }
+         ++this->m_tick_count;
+         ++this->m_stats.observations;
+         if (this->m_tick_count > this->m_stats.peak_per_tick) this->m_stats.peak_per_tick = this->m_tick_count;
+
+         // remove() waits for in flight observers before they may be deleted
+         this->m_in_flight = due;
+         this->m_in_flight_removed = false;
+         this->m_mutex.unlock();
+
+         // observe outside of the lock (get() may block)
+         due->observation_task();
+
+         // reschedule on an absolute deadline so that get() time does not accumulate as drift
+         this->m_mutex.lock();
+         if (this->m_in_flight_removed == false && due->isObserving() == true && due->m_heap_index < 0) {
+             uint64_t now = Kernel::get_ms_count();
+             due->m_deadline += (uint64_t)due->getSleepTime();
+             if (due->m_deadline <= now) {
+                 // we have fallen more than a period behind... skip the missed observations
+                 due->m_deadline = now + (uint64_t)due->getSleepTime();
+             }
+             this->push(due);
+         }
+
+         // release anyone waiting in remove()
+         this->m_in_flight = NULL;
+         while (this->m_in_flight_waiters > 0) {
+             --this->m_in_flight_waiters;
+             this->m_in_flight_done.release();
+         }
+         this->m_mutex.unlock();
+     }
+ }
+
+ // get a snapshot of the statistics
+ ObservationScheduler::Statistics ObservationScheduler::getStatistics() {
+     this->m_mutex.lock();
+     Statistics stats = this->m_stats;
+     this->m_mutex.unlock();
+     return stats;
+ }
+
+ // reset the statistics
+ void ObservationScheduler::resetStatistics() {
+     this->m_mutex.lock();
+     memset(&this->m_stats,0,sizeof(this->m_stats));
+     this->m_tick_count = 0;
+     this->m_mutex.unlock();
+ }
+
+ // log the statistics
+ void ObservationScheduler::logStatistics(Logger *logger) {
+     Statistics stats = this->getStatistics();
+     LOG_INFO(logger,LOGGER_MODULE_OBSERVER,"ObservationScheduler: observers: %d observations: %lu ticks: %lu peak per tick: %lu",
+              this->size(),(unsigned long)stats.observations,(unsigned long)stats.ticks,(unsigned long)stats.peak_per_tick);
+ }
+
+ // first deadline for a newly scheduled observer: the next occurrence of its phase slot (lock held)
+ uint64_t ObservationScheduler::firstDeadline(uint32_t period_ms,uint64_t now) {
+     PeriodGroup *group = NULL;
+     for (int i = 0; i < this->m_num_groups && group == NULL; ++i) {
+         if (this->m_groups[i].period_ms == period_ms) {
+             group = &this->m_groups[i];
+         }
+     }
+     if (group == NULL) {
+         if (this->m_num_groups >= this->m_groups_capacity) {
+             int capacity = (this->m_groups_capacity > 0) ? (2 * this->m_groups_capacity) : SCHEDULER_INITIAL_CAPACITY;
+             PeriodGroup *groups = (PeriodGroup *)realloc(this->m_groups,capacity*sizeof(PeriodGroup));
+             if (groups == NULL) {
+                 // unable to track the period... no phase offset
+                 return now + (uint64_t)period_ms;
+             }
+             this->m_groups = groups;
+             this->m_groups_capacity = capacity;
+         }
+         group = &this->m_groups[this->m_num_groups++];
+         group->period_ms = period_ms;
+         group->anchor_ms = now;
+         group->next_slot = 0;
+     }
+
+     // next occurrence (strictly after now) of anchor + offset
+     uint64_t deadline = group->anchor_ms + (uint64_t)ObservationScheduler::phaseOffset(group->next_slot++,period_ms);
+     if (deadline <= now) {
+         deadline += (((now - deadline) / period_ms) + 1) * (uint64_t)period_ms;
+     }
+     return deadline;
+ }
+
+ // phase offset of a slot: bit-reversed slot number as a fraction of the period (0, 1/2, 1/4, 3/4, 1/8, ...)
+ uint32_t ObservationScheduler::phaseOffset(uint32_t slot,uint32_t period_ms) {
+     uint32_t reversed = 0;
+     for (int i = 0; i < 32; ++i) {
+         reversed = (reversed << 1) | ((slot >> i) & 0x01);
+     }
+     return (uint32_t)(((uint64_t)period_ms * reversed) >> 32);
+ }
+
+ // push an observer onto the heap (lock held)
+ bool ObservationScheduler::push(ScheduledResourceObserver *observer) {
+     if (this->m_size >= this->m_capacity) {
+         int capacity = (this->m_capacity > 0) ? (2 * this->m_capacity) : SCHEDULER_INITIAL_CAPACITY;
+         ScheduledResourceObserver **heap = (ScheduledResourceObserver **)realloc(this->m_heap,capacity*sizeof(ScheduledResourceObserver *));
+         if (heap == NULL) {
+             return false;
+         }
+         this->m_heap = heap;
+         this->m_capacity = capacity;
+     }
+     this->m_heap[this->m_size] = observer;
+     observer->m_heap_index = this->m_size;
+     ++this->m_size;
+     this->siftUp(observer->m_heap_index);
+     return true;
+ }
+
+ // remove the observer at a given heap index (lock held)
+ void ObservationScheduler::removeAt(int index) {
+     ScheduledResourceObserver *observer = this->m_heap[index];
+     int last = this->m_size - 1;
+     if (index != last) {
+         this->swap(index,last);
+     }
+     --this->m_size;
+     observer->m_heap_index = -1;
+     if (index < this->m_size) {
+         this->siftDown(index);
+         this->siftUp(index);
+     }
+ }
+
+ // restore the heap property upwards
+ void ObservationScheduler::siftUp(int index) {
+     while (index > 0) {
+         int parent = (index - 1) / 2;
+         if (this->m_heap[parent]->m_deadline <= this->m_heap[index]->m_deadline) {
+             break;
+         }
+         this->swap(parent,index);
+         index = parent;
+     }
+ }
+
+ // restore the heap property downwards
+ void ObservationScheduler::siftDown(int index) {
+     while (true) {
+         int smallest = index;
+         int left = (2 * index) + 1;
+         int right = left + 1;
+         if (left < this->m_size && this->m_heap[left]->m_deadline < this->m_heap[smallest]->m_deadline) smallest = left;
+         if (right < this->m_size && this->m_heap[right]->m_deadline < this->m_heap[smallest]->m_deadline) smallest = right;
+         if (smallest == index) {
+             break;
+         }
+         this->swap(smallest,index);
+         index = smallest;
+     }
+ }
+
+ // swap two heap entries
+ void ObservationScheduler::swap(int a,int b) {
+     ScheduledResourceObserver *tmp = this->m_heap[a];
+     this->m_heap[a] = this->m_heap[b];
+     this->m_heap[b] = tmp;
+     this->m_heap[a]->m_heap_index = a;
+     this->m_heap[b]->m_heap_index = b;
+ }
+
+ #endif // CONNECTOR_USING_SCHEDULER
@@ -0,0 +1,65 @@
+/**
+ * @file    ObservationTimingResource.cpp
+ * @brief   mbed CoAP Endpoint observation timing diagnostic resource
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ObservationTimingResource.h"
+
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+
+ // ResourceObserver support
+ #include "mbed-connector-interface/ResourceObserver.h"
+
+ // Endpoint support
+ #include "mbed-connector-interface/ConnectorEndpoint.h"
+
+ // constructor
+ ObservationTimingResource::ObservationTimingResource(const Logger *logger,const char *obj_name,const char *res_name,const bool observable) :
+     DynamicResource(logger,obj_name,res_name,"ObservationTiming",M2MBase::GET_ALLOWED,observable) {
+ }
+
+ // timing summary of all observed resources
+ string ObservationTimingResource::get() {
+     char lateness[64];
+     char get_time[64];
+     string summary;
+     Connector::Endpoint *ep = (Connector::Endpoint *)this->m_endpoint;
+     if (ep == NULL || ep->getOptions() == NULL) {
+         return summary;
+     }
+     const DynamicResourcesList *dynamic_resources = ep->getOptions()->getDynamicResourceList();
+     for (int i = 0; i < (int) dynamic_resources->size(); ++i) {
+         ResourceObserver *observer = (ResourceObserver *)dynamic_resources->at(i)->getObserver();
+         if (observer != NULL) {
+             observer->getLatenessHistogram()->format(lateness,sizeof(lateness));
+             observer->getGetTimeHistogram()->format(get_time,sizeof(get_time));
+             string line = dynamic_resources->at(i)->getFullName() + " late_ms " + lateness + " get_us " + get_time + "\n";
+             if (summary.length() + line.length() > MAX_VALUE_BUFFER_LENGTH) {
+                 // keep within the largest value a dynamic resource may assume
+                 break;
+             }
+             summary += line;
+         }
+     }
+     return summary;
+ }
+
+#endif // CONNECTOR_OBSERVATION_TIMING
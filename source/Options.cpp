@@ -168,6 +168,26 @@ int Options::getClientKeySize() {
 	return this->m_client_key_length;
 }
 
+// Get the InboundDispatcher queue depth
+int Options::getInboundDispatchDepth() {
+	return this->m_inbound_dispatch_depth;
+}
+
+// Get the InboundDispatcher overflow policy
+InboundDispatcher::OverflowPolicy Options::getInboundDispatchOverflowPolicy() {
+	return this->m_inbound_dispatch_policy;
+}
+
+// Get the NotificationStore
+NotificationStore *Options::getNotificationStore() {
+	return this->m_notification_store;
+}
+
+// Get the notification coalescing window
+uint32_t Options::getNotificationCoalesceWindow() {
+	return this->m_notification_coalesce_window_ms;
+}
+
 // Get our Endpoint
 void *Options::getEndpoint() {
 	return this->m_endpoint;
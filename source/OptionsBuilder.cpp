@@ -24,6 +24,7 @@
 #include "mbed-connector-interface/OptionsBuilder.h"
 
 // ResourceObserver support
+#include "mbed-connector-interface/ScheduledResourceObserver.h"
 #include "mbed-connector-interface/EventQueueResourceObserver.h"
 #include "mbed-connector-interface/ThreadedResourceObserver.h"
 #include "mbed-connector-interface/TickerResourceObserver.h"
@@ -49,6 +50,10 @@ OptionsBuilder::OptionsBuilder()
     this->m_client_key_length		= 0;
     this->m_device_resources_object = NULL;
     this->m_firmware_resources_object = NULL;
+    this->m_inbound_dispatch_depth = 0;
+    this->m_inbound_dispatch_policy = InboundDispatcher::PROCESS_INLINE;
+    this->m_notification_store = NULL;
+    this->m_notification_coalesce_window_ms = 0;
     this->m_static_resources.clear();
     this->m_dynamic_resources.clear();
     this->m_resource_observers.clear();
@@ -81,6 +86,10 @@ OptionsBuilder::OptionsBuilder(const OptionsBuilder &ob)  : Options(ob)
     this->m_ip_address_type = ob.m_ip_address_type;
     this->m_enable_immediate_observation = ob.m_enable_immediate_observation;
     this->m_enable_get_obs_control = ob.m_enable_get_obs_control;
+    this->m_inbound_dispatch_depth = ob.m_inbound_dispatch_depth;
+    this->m_inbound_dispatch_policy = ob.m_inbound_dispatch_policy;
+    this->m_notification_store = ob.m_notification_store;
+    this->m_notification_coalesce_window_ms = ob.m_notification_coalesce_window_ms;
     this->m_endpoint = ob.m_endpoint;
 }
 
@@ -196,6 +205,11 @@ OptionsBuilder &OptionsBuilder::addResource(const DynamicResource *resource,cons
 			MinarResourceObserver *observer = new MinarResourceObserver((DynamicResource *)resource,(int)sleep_time);
 #endif
 
+#ifdef CONNECTOR_USING_SCHEDULER
+			// mbedOS RTOS shared scheduler ResourceObserver (one thread for all observers)
+            ScheduledResourceObserver *observer = new ScheduledResourceObserver((DynamicResource *)resource,(int)sleep_time);
+#endif
+
 #ifdef CONNECTOR_USING_THREADS
 			// mbedOS RTOS Thread ResourceObserver
             ThreadedResourceObserver *observer = new ThreadedResourceObserver((DynamicResource *)resource,(int)sleep_time);
@@ -276,6 +290,27 @@ OptionsBuilder &OptionsBuilder::setEnableGETObservationControl(bool enable) {
     return *this;
 }
 
+// Enable/Disable the InboundDispatcher
+OptionsBuilder &OptionsBuilder::setInboundDispatcher(int depth,InboundDispatcher::OverflowPolicy policy) {
+    this->m_inbound_dispatch_depth = (depth > 0) ? depth : 0;
+    this->m_inbound_dispatch_policy = policy;
+    return *this;
+}
+
+#if !defined(CONNECTOR_USING_TICKER)
+// Enable/Disable the offline NotificationStore
+OptionsBuilder &OptionsBuilder::setNotificationStore(NotificationStore *store) {
+    this->m_notification_store = store;
+    return *this;
+}
+
+// Enable/Disable notification coalescing
+OptionsBuilder &OptionsBuilder::setNotificationCoalescing(uint32_t window_ms) {
+    this->m_notification_coalesce_window_ms = window_ms;
+    return *this;
+}
+#endif
+
 // set the server certificate
 OptionsBuilder &OptionsBuilder::setServerCertificate(uint8_t *cert,int cert_size) {
     this->m_server_cert = cert;
@@ -0,0 +1,62 @@
+/**
+ * @file    RamNotificationStore.cpp
+ * @brief   mbed CoAP Endpoint store-and-forward notification queue (RAM backend)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/RamNotificationStore.h"
+
+ // constructor
+ RamNotificationStore::RamNotificationStore(uint32_t capacity) : NotificationStore(capacity) {
+     this->m_buffer = NULL;
+ }
+
+ // destructor
+ RamNotificationStore::~RamNotificationStore() {
+     if (this->m_buffer != NULL) {
+         free(this->m_buffer);
+     }
+ }
+
+ // open the store
+ bool RamNotificationStore::open() {
+     if (this->m_buffer == NULL && NotificationStore::open() == true) {
+         this->m_buffer = (uint8_t *)malloc(this->m_capacity);
+     }
+     return this->m_buffer != NULL;
+ }
+
+ // read from the buffer
+ bool RamNotificationStore::readAt(uint32_t offset,uint8_t *buffer,uint32_t length) {
+     if (this->m_buffer == NULL) {
+         return false;
+     }
+     memcpy(buffer,this->m_buffer + offset,length);
+     return true;
+ }
+
+ // write to the buffer
+ bool RamNotificationStore::writeAt(uint32_t offset,const uint8_t *buffer,uint32_t length) {
+     if (this->m_buffer == NULL) {
+         return false;
+     }
+     memcpy(this->m_buffer + offset,buffer,length);
+     return true;
+ }
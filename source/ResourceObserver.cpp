@@ -26,12 +26,18 @@
  // constructor
  ResourceObserver::ResourceObserver(DynamicResource *resource,int sleep_time) : m_is_observing(false), m_sleep_time(sleep_time) {
      this->m_resource = resource;
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+     this->m_expected_ms = 0;
+#endif
      if (resource != NULL) resource->setObserver(this);
  }
 
- // copy constructor
- ResourceObserver::ResourceObserver(const ResourceObserver &observer) {
+ // copy constructor (the copy is not observing until begun... timings start afresh)
+ ResourceObserver::ResourceObserver(const ResourceObserver &observer) : m_is_observing(false), m_sleep_time(observer.m_sleep_time) {
      this->m_resource = observer.m_resource;
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+     this->m_expected_ms = 0;
+#endif
  }
 
  // destructor
@@ -50,9 +56,55 @@
 
  // set our observation state
  void ResourceObserver::setObserving(bool observing) {
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+     if (observing == true && this->m_is_observing == false) {
+         // periodic mechanisms restart their schedule
+         this->m_expected_ms = 0;
+     }
+#endif
      this->m_is_observing = observing;
  }
 
+ // observe our resource, recording its lateness (DynamicResource::observe() records the get() duration)
+ void ResourceObserver::observeResource(uint64_t scheduled_ms) {
+     DynamicResource *res = this->m_resource;
+     if (this->m_is_observing == false || res == NULL || res->canObserve() == false) {
+         return;
+     }
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+     uint64_t now = Kernel::get_ms_count();
+     if (scheduled_ms == 0) {
+         // periodic mechanism: expect one period after the last expected observation
+         if (this->m_expected_ms == 0 || (this->m_sleep_time > 0 && this->m_expected_ms + (uint64_t)this->m_sleep_time <= now)) {
+             // first observation (or more than a period behind)... start over from now
+             this->m_expected_ms = now;
+         }
+         scheduled_ms = this->m_expected_ms;
+         this->m_expected_ms += (uint64_t)this->m_sleep_time;
+     }
+     this->m_lateness.record((now > scheduled_ms) ? (uint32_t)(now - scheduled_ms) : 0);
+#endif
+     res->observe();
+ }
+
+#if defined(CONNECTOR_OBSERVATION_TIMING)
+ // reset the timing histograms
+ void ResourceObserver::resetTimings() {
+     this->m_lateness.reset();
+     this->m_get_time.reset();
+ }
+
+ // log the timing histograms
+ void ResourceObserver::logTimings() {
+     char lateness[64];
+     char get_time[64];
+     this->m_lateness.format(lateness,sizeof(lateness));
+     this->m_get_time.format(get_time,sizeof(get_time));
+     LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"ResourceObserver: [%s] late(ms) %s get(us) %s",
+              (this->m_resource != NULL) ? this->m_resource->getFullName().c_str() : "",lateness,get_time);
+ }
+#endif
+
  // get our sleep time
  int ResourceObserver::getSleepTime() {
      return this->m_sleep_time;
@@ -0,0 +1,67 @@
+/**
+ * @file    ScheduledResourceObserver.cpp
+ * @brief   mbed CoAP DynamicResource shared scheduler-based observer (implementation)
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/ScheduledResourceObserver.h"
+
+ #ifdef CONNECTOR_USING_SCHEDULER
+
+ // constructor
+ ScheduledResourceObserver::ScheduledResourceObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,sleep_time) {
+     this->m_deadline = 0;
+     this->m_heap_index = -1;
+
+     // default is not observing...
+     this->setObserving(false);
+
+     // DEBUG
+     LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"ScheduledResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
+ }
+
+ // destructor
+ ScheduledResourceObserver::~ScheduledResourceObserver() {
+     this->stopObservation();
+ }
+
+ // observation task method
+ void ScheduledResourceObserver::observation_task() {
+     this->observeResource(this->m_deadline);
+ }
+
+ // begin observing...
+ void ScheduledResourceObserver::beginObservation() {
+     this->setObserving(true);
+     ObservationScheduler::instance()->add(this);
+ }
+
+ // stop observing...
+ void ScheduledResourceObserver::stopObservation() {
+     this->setObserving(false);
+     ObservationScheduler::instance()->remove(this);
+ }
+
+ // halt the underlying observer mechanism
+ void ScheduledResourceObserver::halt() {
+     this->stopObservation();
+ }
+
+ #endif // CONNECTOR_USING_SCHEDULER
@@ -0,0 +1,135 @@
+/**
+ * @file    StartupTimer.cpp
+ * @brief   mbed CoAP Endpoint startup phase timer
+ * @author  Doug Anson
+ * @version 1.0
+ * @see
+ *
+ * Copyright (c) 2018
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ // Class support
+ #include "mbed-connector-interface/StartupTimer.h"
+
+ // memset/memcpy support
+ #include <string.h>
+
+ // phase names (indexed by StartupPhase)
+ static const char *_phase_names[StartupTimer::PHASE_COUNT] = {
+     "network",
+     "platform init",
+     "provisioning",
+     "bind device manager",
+     "bind static resources",
+     "bind dynamic resources",
+     "registration"
+ };
+
+ // constructor
+ StartupTimer::StartupTimer() {
+     this->m_origin = this->now();
+     memset(this->m_begin,0,sizeof(this->m_begin));
+     memset(this->m_end,0,sizeof(this->m_end));
+     memset(this->m_complete,0,sizeof(this->m_complete));
+ }
+
+ // copy constructor
+ StartupTimer::StartupTimer(const StartupTimer &timer) {
+     *this = timer;
+ }
+
+ // assignment
+ StartupTimer &StartupTimer::operator=(const StartupTimer &timer) {
+     if (this != &timer) {
+         this->m_origin = timer.m_origin;
+         memcpy(this->m_begin,timer.m_begin,sizeof(this->m_begin));
+         memcpy(this->m_end,timer.m_end,sizeof(this->m_end));
+         memcpy(this->m_complete,timer.m_complete,sizeof(this->m_complete));
+     }
+     return *this;
+ }
+
+ // destructor
+ StartupTimer::~StartupTimer() {
+ }
+
+ // mark the beginning of a phase
+ void StartupTimer::begin(int phase) {
+     if (phase >= 0 && phase < PHASE_COUNT) {
+         this->m_begin[phase] = this->elapsed();
+         this->m_end[phase] = 0;
+         this->m_complete[phase] = 0;
+     }
+ }
+
+ // mark the completion of a phase
+ uint32_t StartupTimer::end(int phase) {
+     if (phase >= 0 && phase < PHASE_COUNT) {
+         this->m_end[phase] = this->elapsed();
+         this->m_complete[phase] = 1;
+         return this->duration(phase);
+     }
+     return 0;
+ }
+
+ // phase completed?
+ bool StartupTimer::isComplete(int phase) {
+     return (phase >= 0 && phase < PHASE_COUNT && this->m_complete[phase] != 0);
+ }
+
+ // duration of a completed phase
+ uint32_t StartupTimer::duration(int phase) {
+     if (this->isComplete(phase) == true) {
+         return this->m_end[phase] - this->m_begin[phase];
+     }
+     return 0;
+ }
+
+ // completion time of a phase
+ uint32_t StartupTimer::completedAt(int phase) {
+     if (this->isComplete(phase) == true) {
+         return this->m_end[phase];
+     }
+     return 0;
+ }
+
+ // time since our origin
+ uint32_t StartupTimer::elapsed() {
+     return (uint32_t)(this->now() - this->m_origin);
+ }
+
+ // phase name
+ const char *StartupTimer::name(int phase) {
+     if (phase >= 0 && phase < PHASE_COUNT) {
+         return _phase_names[phase];
+     }
+     return "unknown";
+ }
+
+ // log a summary of the completed phases
+ void StartupTimer::logTimings(Logger *logger) {
+     if (logger != NULL) {
+         for (int i = 0; i < PHASE_COUNT; ++i) {
+             if (this->isComplete(i) == true) {
+                 LOG_INFO(logger,LOGGER_MODULE_ENDPOINT,"StartupTimer: %-24s %6lu ms (completed at %lu ms)",StartupTimer::name(i),(unsigned long)this->duration(i),(unsigned long)this->completedAt(i));
+             }
+         }
+     }
+ }
+
+ // current time (ms)
+ uint64_t StartupTimer::now() {
+     return Kernel::get_ms_count();
+ }
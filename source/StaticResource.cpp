@@ -76,29 +76,29 @@ void StaticResource::bind(void *ep) {
             this->getDataWrapper()->wrap((uint8_t *)this->getValue().c_str(),(int)this->getValue().size());
             
 			// Create our Resource
-			this->m_res = (M2MResource *)oim->createStaticResourceInstance((char *)this->getObjName().c_str(),(char *)this->getResName().c_str(),(char *)"StaticResource",(int)type,(void *)this->getDataWrapper()->get(),(int)this->getDataWrapper()->length());
+			this->m_res = (M2MResource *)oim->createStaticResourceInstance(this->getObjId(),this->getResId(),"StaticResource",(int)type,(void *)this->getDataWrapper()->get(),(int)this->getDataWrapper()->length());
 			if (this->m_res != NULL) {
 				// Record our Instance Number
 				this->setInstanceNumber(oim->getLastCreatedInstanceNumber());
 			
 				// DEBUG
-				this->logger()->log("StaticResource: [%s] value: [%s] bound",this->getFullName().c_str(),this->getDataWrapper()->get());
+				LOG_INFO(this->logger(),LOGGER_MODULE_RESOURCE,"StaticResource: [%s] value: [%s] bound",this->getFullName().c_str(),this->getDataWrapper()->get());
 			}
 		}
 		else {
 			// Create our Resource
-			this->m_res = (M2MResource *)oim->createStaticResourceInstance((char *)this->getObjName().c_str(),(char *)this->getResName().c_str(),(char *)"StaticResource",(int)type,(void *)this->getValue().c_str(),(int)this->getValue().size());
+			this->m_res = (M2MResource *)oim->createStaticResourceInstance(this->getObjId(),this->getResId(),"StaticResource",(int)type,(void *)this->getValue().c_str(),(int)this->getValue().size());
 			if (this->m_res != NULL) {
 				// Record our Instance Number
 				this->setInstanceNumber(oim->getLastCreatedInstanceNumber());
 			
 				// DEBUG
-				this->logger()->log("StaticResource: [%s] value: [%s] bound",this->getFullName().c_str(),this->getValue().c_str());
+				LOG_INFO(this->logger(),LOGGER_MODULE_RESOURCE,"StaticResource: [%s] value: [%s] bound",this->getFullName().c_str(),this->getValue().c_str());
 			}
 		}
 	}
 	else {
 		// no instance pointer to our endpoint
-      	this->logger()->log("%s: NULL endpoint instance pointer in bind() request...",this->getFullName().c_str());
+      	LOG_INFO(this->logger(),LOGGER_MODULE_RESOURCE,"%s: NULL endpoint instance pointer in bind() request...",this->getFullName().c_str());
     }
 }
\ No newline at end of file
@@ -31,7 +31,7 @@
         this->setObserving(false);
         
         // DEBUG
-        this->logger()->log("ThreadedResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
+        LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"ThreadedResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
         
         // start the thread by invoking the thread task...
         this->m_observation_thread.start(callback(this,&ThreadedResourceObserver::observation_task));
@@ -45,13 +45,16 @@
  
  // observation task method
  void ThreadedResourceObserver::observation_task() {
+     // absolute deadlines: time spent in get() does not accumulate as drift
+     uint64_t deadline = Kernel::get_ms_count() + (uint64_t)this->getSleepTime();
      while(true) {
-         ThisThread::sleep_for(this->getSleepTime());
-         if (this->isObserving() == true && this->getResource() != NULL) {
-             DynamicResource *res = this->getResource();
-             if (res != NULL && res->isRegistered() == true) {
-                 res->observe();
-             }
+         ThisThread::sleep_until(deadline);
+         this->observeResource(deadline);
+         uint64_t now = Kernel::get_ms_count();
+         deadline += (uint64_t)this->getSleepTime();
+         if (deadline <= now) {
+             // we have fallen more than a period behind... skip the missed observations
+             deadline = now + (uint64_t)this->getSleepTime();
          }
      }
  }
@@ -25,18 +25,12 @@
  
  #ifdef CONNECTOR_USING_TICKER
  
- // our instance
- static void *_instance = NULL;
-  
  // constructor
- TickerResourceObserver::TickerResourceObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,(int)(sleep_time/1000)) {
+ TickerResourceObserver::TickerResourceObserver(DynamicResource *resource,int sleep_time) : ResourceObserver(resource,sleep_time) {
      this->setObserving(false);
      
      // DEBUG
-     this->logger()->log("TickerResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
-     
-     // our instance
-     _instance = (void *)this;
+     LOG_INFO(this->logger(),LOGGER_MODULE_OBSERVER,"TickerResourceObserver being used for %s (sleep_time: %d ms)",resource->getFullName().c_str(),sleep_time);
  }
   
  // destructor
@@ -46,26 +40,21 @@
 
  // observation task method
  void TickerResourceObserver::observation_task() {
-     TickerResourceObserver *me = (TickerResourceObserver *)_instance;
-     if (me != NULL && me->isObserving() == true && me->getResource() != NULL) {
-         DynamicResource *res = me->getResource();
-         if (res != NULL && res->isRegistered() == true) {
-             res->observe();
-         }
-     }
+     this->observeResource(0);
  }
  
  // begin observing...
  void TickerResourceObserver::beginObservation() {
-     if (this->isObserving() == false) {
-        this->m_ticker.attach(this,&TickerResourceObserver::observation_task,(float)this->getSleepTime());
+     if (this->isObserving() == false && this->getSleepTime() > 0) {
+        this->m_ticker.attach_us(callback(this,&TickerResourceObserver::observation_task),(us_timestamp_t)this->getSleepTime() * 1000);
         this->setObserving(true);
      }
  }
  
- // begin observing...
+ // stop observing...
  void TickerResourceObserver::stopObservation() {
      this->setObserving(false);
+     this->m_ticker.detach();
  }
 
  // halt the underlying observer mechanism
@@ -52,14 +52,14 @@ bool utils_init_platform() {
    	// Initialize storage
 	if (mcc_platform_storage_init() != 0) 
 	{
-        logger.log("utils_init_platform: Failed to initialize storage");
+        LOG_ERROR(&logger,LOGGER_MODULE_ENDPOINT,"utils_init_platform: Failed to initialize storage");
         return false;
     }
 
     // Initialize platform-specific components
     if(mcc_platform_init() != 0) 
     {
-        logger.log("utils_init_platform: ERROR - mcc_platform_init() failed!");
+        LOG_ERROR(&logger,LOGGER_MODULE_ENDPOINT,"utils_init_platform: ERROR - mcc_platform_init() failed!");
         return false;
     }
 
@@ -67,19 +67,20 @@ bool utils_init_platform() {
     mcc_platform_sw_build_info();
 
     // platform is initialized
-    logger.log("utils_init_platform(): platform initialized... Starting FCC...");
-    return application_init();
+    LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"utils_init_platform(): platform initialized.");
+    return true;
 }
 
-// initialize the appropriate provisioning flow
+// initialize the appropriate provisioning flow (FCC init and device configuration verification)
 bool utils_init_provisioning_flow() {
-     return true;
+     LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"utils_init_provisioning_flow(): Starting FCC...");
+     return application_init();
 }
 
 // initialize the Connector::Endpoint instance
 void *utils_init_endpoint(bool canActAsRouterNode) {
 	// alloc Endpoint
-    logger.log("Endpoint: allocating endpoint instance...");
+    LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: allocating endpoint instance...");
 	Connector::Endpoint *ep = new Connector::Endpoint(&logger,options);
 	if (ep != NULL) {
 		// link to config object
@@ -102,7 +103,7 @@ void utils_configure_endpoint(void *p)
 	Connector::Endpoint *ep = (Connector::Endpoint *)p;
 	
     // default configuration - see mbedConnectorInterface.h for definitions... 
-    logger.log("Endpoint: setting defaults...");
+    LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: setting defaults...");
     config.setEndpointNodename(NODE_NAME);
     config.setEndpointType(DEFAULT_ENDPOINT_TYPE);
     config.setLifetime(REG_LIFETIME_SEC);
@@ -134,22 +135,22 @@ void utils_configure_endpoint(void *p)
 	// Device Manager installation
     DeviceManager *device_manager = (DeviceManager *)ep->getDeviceManager();
     if (device_manager != NULL) {
-    	logger.log("Endpoint: installing and setting up device manager and its resources...");
+    	LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: installing and setting up device manager and its resources...");
     	device_manager->install((void *)ep,(void *)&config);
     }
     else {
-    	logger.log("Endpoint: no device manager installed...");
+    	LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: no device manager installed...");
     }
     
     // main.cpp can override or change any of the above defaults...
-    logger.log("Endpoint: gathering configuration overrides...");
+    LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: gathering configuration overrides...");
     options = configure_endpoint(config);
     
     // set our options
 	ep->setOptions(options);
 	
     // DONE
-    logger.log("Endpoint: endpoint configuration completed.");
+    LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: endpoint configuration completed.");
 }
 
 // build out the endpoint and its resources
@@ -157,7 +158,7 @@ void utils_build_endpoint(void *p)
 {
     if (p != NULL) {
     	// Build the Endpoint
-    	logger.log("Endpoint: building endpoint and its resources...");
+    	LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: building endpoint and its resources...");
 		Connector::Endpoint *ep = (Connector::Endpoint *)p;
 	    ep->buildEndpoint();
 	}
@@ -204,12 +205,12 @@ uint16_t extract_port_from_url(char *url,uint16_t default_port)
 			port = default_port;
 			
 			// DEBUG
-			logger.log("Endpoint: Connector IPV6 uri: %s path: %s port: %d",uri,path,port);
+			LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: Connector IPV6 uri: %s path: %s port: %d",uri,path,port);
 		}
 	}
 	
 	// DEBUG
-	logger.log("Endpoint: Connector URL: %s CoAP port: %u",url,port);
+	LOG_INFO(&logger,LOGGER_MODULE_ENDPOINT,"Endpoint: Connector URL: %s CoAP port: %u",url,port);
 	
 	// return the port
 	return port; 
@@ -32,6 +32,9 @@
 // MCC support
 #include "mcc_common_setup.h"
 
+// Connection management (backoff, reconnection)
+#include "mbed-connector-interface/ConnectionManager.h"
+
 // Network Selection
 #define NETWORK_TYPE  (char *)"Automatic"
 
@@ -44,12 +47,34 @@ static void *_endpoint_instance = NULL;
 // LWIP network instance forward reference
 extern NetworkInterface *__network_interface;
 
-// main loop cycle period
-static int _main_loop_iteration_wait_ms = MAIN_LOOP_WAIT_TIME_MS;
+// main loop events
+#define MAIN_LOOP_FLAG_SHUTDOWN				0x01		// net_shutdown_endpoint()
+#define MAIN_LOOP_FLAG_REGISTRATION			0x02		// net_registration_changed()
+#define MAIN_LOOP_FLAG_WORK					0x04		// net_post_work()
+#define MAIN_LOOP_FLAG_LINK					0x08		// network link status changed
+#define MAIN_LOOP_FLAG_REREGISTER			0x10		// re-registration backoff elapsed
+#define MAIN_LOOP_FLAGS						(MAIN_LOOP_FLAG_SHUTDOWN | MAIN_LOOP_FLAG_REGISTRATION | MAIN_LOOP_FLAG_WORK | MAIN_LOOP_FLAG_LINK | MAIN_LOOP_FLAG_REREGISTER)
+static EventFlags _main_loop_flags;
+
+// re-registration after an outage we did not ask for (paced by the ConnectionManager backoff)
+static Timeout _reregistration_timer;
+static volatile bool _reregistration_pending = false;
+
+// work posted to the main loop (ring... guarded by critical sections so that ISRs may post)
+typedef struct {
+	void (*work)(void *);
+	void  *arg;
+} MainLoopWork;
+static MainLoopWork _main_loop_work[MAIN_LOOP_WORK_QUEUE_DEPTH];
+static uint32_t _main_loop_work_head = 0;
+static uint32_t _main_loop_work_tail = 0;
 
 // endpoint shutdown indicator
 static volatile bool _shutdown_endpoint = false;			
 
+// network connection manager
+static ConnectionManager _connection_manager(&logger);
+
 extern "C" {
 
 /*********************** START LOCAL FUNCTIONS **************************/
@@ -59,13 +84,13 @@ void start_endpoint_shutdown(void) {
 	if (_shutdown_endpoint == true) {
 		Connector::Endpoint *ep = (Connector::Endpoint *)_endpoint_instance;
 		if (ep != NULL && ep->isRegistered() == true) {
-			logger.log("mbedEndpointNetwork(%s): shutdown requested. De-registering the endpoint...",NETWORK_TYPE);
+			LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): shutdown requested. De-registering the endpoint...",NETWORK_TYPE);
 			ep->de_register_endpoint();
 		}
 	}
 	
 	// ready to shutdown...
-	logger.log("mbedEndpointNetwork(%s): endpoint shutdown. Bye!",NETWORK_TYPE);
+	LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): endpoint shutdown. Bye!",NETWORK_TYPE);
 	while(true) {ThisThread::sleep_for(10000);}
 }
 	
@@ -73,7 +98,7 @@ void start_endpoint_shutdown(void) {
 #if MBED_CONF_APP_SHUTDOWN_BUTTON_ENABLE == true
 InterruptIn shutdown_button(MBED_CONF_APP_SHUTDOWN_PIN);
 void configure_deregistration_button(void) {
-	logger.log("mbedEndpointNetwork(%s): configuring de-registration button...",NETWORK_TYPE); 
+	LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): configuring de-registration button...",NETWORK_TYPE); 
 	shutdown_button.fall(&net_shutdown_endpoint);
 }
 #endif
@@ -85,32 +110,110 @@ void setup_deregistration_button(void) {
 #endif
 }
 
+// link status changed (network stack context)
+void main_loop_link_changed(void) {
+	_main_loop_flags.set(MAIN_LOOP_FLAG_LINK);
+}
+
+// re-registration backoff elapsed (ISR context)
+void main_loop_reregistration_due(void) {
+	_main_loop_flags.set(MAIN_LOOP_FLAG_REREGISTER);
+}
+
 // configure main loop parameters
-void configure_main_loop_params(Connector::Endpoint *endpoint) {
+void configure_main_loop_params(Connector::Endpoint * /* endpoint */) {
 	// set the initial shutdown state
 	_shutdown_endpoint = false;
+	_reregistration_timer.detach();
+	_reregistration_pending = false;
+	
+	// wake the main loop on link status changes
+	_connection_manager.attach(callback(main_loop_link_changed));
+}
+
+// run the work posted to the main loop
+void run_main_loop_work(void) {
+	while(true) {
+		MainLoopWork item;
+		bool have_work = false;
+		core_util_critical_section_enter();
+		if (_main_loop_work_tail != _main_loop_work_head) {
+			item = _main_loop_work[_main_loop_work_tail % MAIN_LOOP_WORK_QUEUE_DEPTH];
+			++_main_loop_work_tail;
+			have_work = true;
+		}
+		core_util_critical_section_exit();
+		if (have_work == false) {
+			return;
+		}
+		item.work(item.arg);
+	}
 }
 
 // perform an actvity in the main loop
-void peform_main_loop_activity(void) {
-	// empty for now...
-	;
+void peform_main_loop_activity(uint32_t flags) {
+	Connector::Endpoint *ep = (Connector::Endpoint *)_endpoint_instance;
+	
+	// application work
+	if ((flags & MAIN_LOOP_FLAG_WORK) != 0) {
+		run_main_loop_work();
+	}
+	
+	// registration state changed
+	if ((flags & MAIN_LOOP_FLAG_REGISTRATION) != 0 && ep != NULL) {
+		LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): registration changed (registered: %d)",NETWORK_TYPE,ep->isRegistered());
+		if (ep->isRegistered() == true) {
+			_connection_manager.registrationSucceeded();
+		}
+	}
+	
+	// link status changed: keep the endpoint in sync (the ConnectionManager reconnects on its own thread)
+	if ((flags & MAIN_LOOP_FLAG_LINK) != 0 && ep != NULL && ep->isConnected() != _connection_manager.isConnected()) {
+		ep->isConnected(_connection_manager.isConnected());
+		if (ep->isConnected() == true) {
+			_connection_manager.logStatistics();
+		}
+	}
+	
+	// riding out an outage with a NotificationStore: register again once the link is up, backing off between attempts
+	bool ride_out = (ep != NULL && ep->getNotificationStore() != NULL && ep->isRegistered() == false && ep->isConnected() == true);
+	if ((flags & MAIN_LOOP_FLAG_REREGISTER) != 0) {
+		_reregistration_pending = false;
+		if (ride_out == true) {
+			ep->re_register_endpoint();
+		}
+	}
+	else if ((flags & (MAIN_LOOP_FLAG_REGISTRATION | MAIN_LOOP_FLAG_LINK)) != 0 && ride_out == true && _reregistration_pending == false) {
+		uint32_t delay_ms = _connection_manager.nextRegistrationDelay();
+		LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): re-registering in %lu ms...",NETWORK_TYPE,(unsigned long)delay_ms);
+		_reregistration_pending = true;
+		_reregistration_timer.attach_us(callback(main_loop_reregistration_due),(us_timestamp_t)delay_ms * 1000);
+	}
+}
+
+// wait (up to timeout_ms) for main loop events and handle them (false once a shutdown has been requested)
+bool run_main_loop_once(uint32_t timeout_ms) {
+	if (_shutdown_endpoint == false) {
+		uint32_t flags = _main_loop_flags.wait_any(MAIN_LOOP_FLAGS,timeout_ms);
+		if ((flags & osFlagsError) == 0 && _shutdown_endpoint == false) {
+			peform_main_loop_activity(flags);
+		}
+	}
+	return (_shutdown_endpoint == false);
 }
 
 // begin the main loop for processing endpoint events
 void begin_main_loop(void) 
 {
 	// DEBUG
-	logger.log("mbedEndpointNetwork(%s): endpoint main loop beginning...",NETWORK_TYPE);
+	LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): endpoint main loop beginning...",NETWORK_TYPE);
 	
-	// enter our main loop (until the shutdown condition flags it...)
-	while(_shutdown_endpoint == false) {
-		ThisThread::sleep_for(_main_loop_iteration_wait_ms);
-		peform_main_loop_activity();
+	// enter our main loop (until the shutdown condition flags it...). We only wake for events
+	while(run_main_loop_once(osWaitForever) == true) {
 	}
 	
 	// main loop has exited... start the endpoint shutdown...
-	logger.log("mbedEndpointNetwork(%s): endpoint main loop exited. Starting endpoint shutdown...",NETWORK_TYPE);
+	LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): endpoint main loop exited. Starting endpoint shutdown...",NETWORK_TYPE);
 	start_endpoint_shutdown();
 }
 
@@ -123,9 +226,39 @@ char *net_get_type() {
 	return NETWORK_TYPE;
 }
 
-// shutdown the endpoint
+// shutdown the endpoint (ISR safe)
 void net_shutdown_endpoint() {
     _shutdown_endpoint = true;
+    _main_loop_flags.set(MAIN_LOOP_FLAG_SHUTDOWN);
+}
+
+// registration state changed (ISR safe)
+void net_registration_changed() {
+    _main_loop_flags.set(MAIN_LOOP_FLAG_REGISTRATION);
+}
+
+// post work to be run on the main loop thread (ISR safe)
+bool net_post_work(void (*work)(void *),void *arg) {
+	bool posted = false;
+	if (work != NULL) {
+		core_util_critical_section_enter();
+		if ((_main_loop_work_head - _main_loop_work_tail) < MAIN_LOOP_WORK_QUEUE_DEPTH) {
+			_main_loop_work[_main_loop_work_head % MAIN_LOOP_WORK_QUEUE_DEPTH].work = work;
+			_main_loop_work[_main_loop_work_head % MAIN_LOOP_WORK_QUEUE_DEPTH].arg = arg;
+			++_main_loop_work_head;
+			posted = true;
+		}
+		core_util_critical_section_exit();
+		if (posted == true) {
+			_main_loop_flags.set(MAIN_LOOP_FLAG_WORK);
+		}
+	}
+	return posted;
+}
+
+// get the network connection manager
+void *net_get_connection_manager() {
+	return (void *)&_connection_manager;
 }
 	
 // called after the endpoint is configured...
@@ -142,29 +275,29 @@ void net_plumb_network(void *p)
 	}
     
     // call MCC to get us connected
-    if (!mcc_platform_init_connection()) 
+    if (ep != NULL) 
+    {
+    	ep->startupPhaseBegin(StartupTimer::PHASE_NETWORK);
+    }
+    // connect (backing off between failed attempts... see CONNECTION_BACKOFF_* and CONNECTION_MAX_ATTEMPTS)
+    NetworkInterface *net = (NetworkInterface *)mcc_platform_get_network_interface();
+    if (net != NULL && _connection_manager.connect(net) == NSAPI_ERROR_OK) 
     {
-    	// connect (MCC-integrated in mbedOS 5.10+)
-    	if (__network_interface == NULL) 
-    	{
-        	__network_interface = (NetworkInterface *)mcc_platform_get_network_interface();
-    	}
-
-		// if we are connected, we are ready... 
-		if (__network_interface != NULL) 
+		// we are connected, we are ready... 
+		__network_interface = net;
+		_connection_manager.logStatistics();
+		if (ep != NULL) 
 		{
-			if (ep != NULL) 
-			{
-    			ep->isConnected(true);
+    		ep->isConnected(true);
+    		ep->startupPhaseEnd(StartupTimer::PHASE_NETWORK);
     	
-    			// Debug
-   				logger.log("mbedEndpointNetwork(%s): IP Address: %s",NETWORK_TYPE,__network_interface->get_ip_address());
-   			}
+    		// Debug
+   			LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): IP Address: %s",NETWORK_TYPE,__network_interface->get_ip_address());
    		}
 	}
 	else 
 	{
-		logger.log("mbedEndpointNetwork(%s): Connection to network FAILED",NETWORK_TYPE);
+		LOG_ERROR(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): Connection to network FAILED",NETWORK_TYPE);
 	}
 }
 
@@ -181,7 +314,7 @@ void net_finalize_and_run_endpoint_main_loop(void *p)
     setup_deregistration_button();
 
 	// register the endpoint
-	logger.log("mbedEndpointNetwork(%s): registering endpoint...",NETWORK_TYPE); 
+	LOG_INFO(&logger,LOGGER_MODULE_NETWORK,"mbedEndpointNetwork(%s): registering endpoint...",NETWORK_TYPE); 
 	ep->register_endpoint(NULL,ep->getEndpointObjectList());
 	       
     // Begin the endpoint's main loop
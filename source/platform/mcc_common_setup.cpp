@@ -42,15 +42,6 @@ extern "C" int mcc_platform_sw_build_info(void) {
    return 0;
 }
 
-extern "C" int mcc_platform_init_connection(void) {
-    nsapi_error_t net_status = NSAPI_ERROR_NO_CONNECTION;
-    while ((net_status = net->connect()) != NSAPI_ERROR_OK) {
-        printf("Unable to connect to network (%d). Retrying...\n", net_status);
-    }
-    printf("Connected to the network successfully. IP address: %s\n", net->get_ip_address());
-    return 0;
-}
-
 extern "C" void *mcc_platform_get_network_interface(void) {
    return (void *)net;
 }
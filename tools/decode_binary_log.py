@@ -0,0 +1,153 @@
+#!/usr/bin/env python
+#
+# @file    decode_binary_log.py
+# @brief   Host-side decoder for mbed Connector Interface binary (Logger::startBinary()) log output
+# @author  Doug Anson
+# @version 1.0
+#
+# Copyright (c) 2018
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Usage:
+#   decode_binary_log.py <application.elf> [captured_log.bin]     (reads stdin if no capture file is given)
+#
+# Frames are [0xA5][0x5A][length:16 LE][format address:32 LE][raw arguments]. Format strings are read from the
+# ELF image by address; arguments are decoded with the same rules as Logger::encodeBinary(). Requires pyelftools.
+#
+
+import re
+import struct
+import sys
+
+FRAME_SYNC = b'\xa5\x5a'
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diuxXoceEfFgGaAspn%])')
+
+
+class FormatTable(object):
+    """ resolves format string addresses against the loadable sections of an ELF image """
+
+    def __init__(self, elf_path):
+        # only needed to resolve format strings (the frame/argument decoding is usable without it)
+        from elftools.elf.elffile import ELFFile
+        self.sections = []
+        self.cache = {}
+        with open(elf_path, 'rb') as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if section['sh_addr'] != 0 and section['sh_type'] == 'SHT_PROGBITS':
+                    self.sections.append((section['sh_addr'], section.data()))
+
+    def lookup(self, address):
+        if address in self.cache:
+            return self.cache[address]
+        for base, data in self.sections:
+            if base <= address < base + len(data):
+                start = address - base
+                end = data.find(b'\0', start)
+                text = data[start:end if end >= 0 else len(data)].decode('latin-1')
+                self.cache[address] = text
+                return text
+        return None
+
+
+def decode_arguments(fmt, payload):
+    """ rebuild the python format string and argument tuple (mirrors Logger::encodeBinary()) """
+    args = []
+    offset = [0]
+
+    def take(size, code):
+        value = struct.unpack_from('<' + code, payload, offset[0])[0]
+        offset[0] += size
+        return value
+
+    def convert(match):
+        flags, width, precision, length, conv = match.groups()
+        if conv == '%':
+            return '%%'
+        if width == '*':
+            args.append(take(4, 'i'))
+        if precision == '*':
+            args.append(take(4, 'i'))
+        wide = length in ('ll', 'j')
+        if conv in 'di':
+            args.append(take(8, 'q') if wide else take(4, 'i'))
+        elif conv in 'uxXoc':
+            args.append(take(8, 'Q') if wide else take(4, 'I'))
+        elif conv in 'eEfFgGaA':
+            args.append(take(8, 'd'))
+            conv = 'e' if conv in 'aA' else conv
+        elif conv == 's':
+            count = take(1, 'B')
+            args.append(payload[offset[0]:offset[0] + count].decode('latin-1'))
+            offset[0] += count
+        elif conv == 'p':
+            args.append(take(4, 'I'))
+            return '0x%08x'
+        elif conv == 'n':
+            return ''
+        spec = '%' + flags + (width or '') + (('.' + precision) if precision is not None else '')
+        return spec + ('d' if conv == 'u' else conv)
+
+    python_fmt = CONVERSION.sub(convert, fmt)
+    return python_fmt, tuple(args)
+
+
+def frames(stream):
+    """ yield (format address, argument bytes) for each frame, resynchronizing on the sync bytes """
+    buffer = b''
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        buffer += chunk
+        while True:
+            start = buffer.find(FRAME_SYNC)
+            if start < 0:
+                buffer = buffer[-1:]
+                break
+            if len(buffer) < start + 4:
+                buffer = buffer[start:]
+                break
+            length = struct.unpack_from('<H', buffer, start + 2)[0]
+            if len(buffer) < start + 4 + length:
+                buffer = buffer[start:]
+                break
+            record = buffer[start + 4:start + 4 + length]
+            buffer = buffer[start + 4 + length:]
+            if length >= 4:
+                yield struct.unpack_from('<I', record, 0)[0], record[4:]
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write('usage: %s <application.elf> [captured_log.bin]\n' % argv[0])
+        return 1
+    table = FormatTable(argv[1])
+    stream = open(argv[2], 'rb') if len(argv) > 2 else getattr(sys.stdin, 'buffer', sys.stdin)
+    out = sys.stdout
+    for address, payload in frames(stream):
+        fmt = table.lookup(address)
+        if fmt is None:
+            out.write('<unknown format 0x%08x: %d argument bytes>\n' % (address, len(payload)))
+            continue
+        try:
+            python_fmt, args = decode_arguments(fmt, payload)
+            out.write((python_fmt % args).replace('\r\n', '\n'))
+        except (struct.error, TypeError, ValueError) as e:
+            out.write('<undecodable record for "%s": %s>\n' % (fmt.strip(), e))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))